@@ -1404,6 +1404,12 @@ class V8_EXPORT ScriptCompiler {
     enum Encoding { ONE_BYTE, TWO_BYTE, UTF8 };
 
     StreamedSource(ExternalSourceStream* source_stream, Encoding encoding);
+    // Code cache to be consumed when streaming with kConsumeCodeCache. The
+    // StreamedSource takes ownership of the CachedData; the cache is checked
+    // on the streaming thread and deserialized on the main thread in Compile.
+    // Whether it was rejected can be read back via GetCachedData.
+    StreamedSource(ExternalSourceStream* source_stream, Encoding encoding,
+                   CachedData* cached_data);
     ~StreamedSource();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1490,6 +1496,10 @@ class V8_EXPORT ScriptCompiler {
    *
    * This API allows to start the streaming with as little data as possible, and
    * the remaining data (for example, the ScriptOrigin) is passed to Compile.
+   *
+   * With kConsumeCodeCache, the StreamedSource must have been created with
+   * cached data. The task then verifies the cache instead of parsing, and only
+   * parses the script if the cache is rejected.
    */
   static ScriptStreamingTask* StartStreamingScript(
       Isolate* isolate, StreamedSource* source,
@@ -1566,6 +1576,19 @@ class V8_EXPORT ScriptCompiler {
       Local<String> arguments[], size_t context_extension_count,
       Local<Object> context_extensions[]);
 
+  /**
+   * Creates and returns code cache for the specified unbound_script.
+   * This will return nullptr if the script cannot be serialized. The
+   * CachedData returned by this function should be owned by the caller.
+   *
+   * Unlike kProduceCodeCache, this can be called at any time after
+   * compilation, e.g. after the script has run, and the resulting cache
+   * then also contains the functions that were lazily compiled until then.
+   * It is consumed with kConsumeCodeCache as usual.
+   */
+  static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script,
+                                     Local<String> source);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options);
@@ -6175,6 +6198,21 @@ class V8_EXPORT ResourceConstraints {
     max_zone_pool_size_ = bytes;
   }
 
+  /**
+   * The fraction of time, between 0 and 1 exclusive, that the heap growing
+   * strategy aims to leave to JavaScript execution between two full garbage
+   * collections, given the allocation rate and GC speed measured so far.
+   * Higher values favor latency and throughput at the cost of a larger heap;
+   * lower values favor a small memory footprint at the cost of more frequent
+   * garbage collections. Zero selects the V8 default.
+   */
+  double target_mutator_utilization() const {
+    return target_mutator_utilization_;
+  }
+  void set_target_mutator_utilization(double value) {
+    target_mutator_utilization_ = value;
+  }
+
  private:
   // max_semi_space_size_ is in KB
   size_t max_semi_space_size_in_kb_;
@@ -6185,6 +6223,7 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   size_t code_range_size_;
   size_t max_zone_pool_size_;
+  double target_mutator_utilization_;
 };
 
 
@@ -6195,6 +6234,16 @@ typedef void (*FatalErrorCallback)(const char* location, const char* message);
 
 typedef void (*OOMErrorCallback)(const char* location, bool is_heap_oom);
 
+/**
+ * This callback is invoked when the heap size is close to the heap limit and
+ * V8 is likely to abort with out-of-memory error.
+ * The callback can extend the heap limit by returning a value that is greater
+ * than the current_heap_limit. The initial heap limit is the limit that was
+ * set after heap setup.
+ */
+typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
+                                        size_t initial_heap_limit);
+
 typedef void (*DcheckErrorCallback)(const char* file, int line,
                                     const char* message);
 
@@ -6501,6 +6550,13 @@ class V8_EXPORT HeapStatistics {
   size_t malloced_memory() { return malloced_memory_; }
   size_t peak_malloced_memory() { return peak_malloced_memory_; }
 
+  /**
+   * Returns the amount of externally allocated memory that V8 is aware of,
+   * e.g., array buffer backing stores and memory reported through
+   * Isolate::AdjustAmountOfExternalAllocatedMemory.
+   */
+  size_t external_memory() { return external_memory_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -6516,6 +6572,7 @@ class V8_EXPORT HeapStatistics {
   size_t heap_size_limit_;
   size_t malloced_memory_;
   size_t peak_malloced_memory_;
+  size_t external_memory_;
   bool does_zap_garbage_;
 
   friend class V8;
@@ -7399,6 +7456,26 @@ class V8_EXPORT Isolate {
                                 void* data = nullptr);
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  /**
+   * Adds a callback to invoke in case the heap size is close to the heap limit.
+   * If multiple callbacks are added, only the most recently added callback is
+   * invoked.
+   *
+   * To recover from the situation without crashing the process, the callback
+   * can return a higher heap limit and call TerminateExecution(), so that the
+   * pending allocation succeeds and the running script is terminated.
+   */
+  void AddNearHeapLimitCallback(NearHeapLimitCallback callback, void* data);
+
+  /**
+   * Removes the given callback that was installed by AddNearHeapLimitCallback
+   * function. If the heap_limit is not zero, then the heap limit will be
+   * restored to that value, but not lower than the current live size plus
+   * some slack.
+   */
+  void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                   size_t heap_limit);
+
   typedef size_t (*GetExternallyAllocatedMemoryInBytesCallback)();
 
   /**
@@ -902,7 +902,8 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       stack_limit_(nullptr),
       code_range_size_(0),
-      max_zone_pool_size_(0) {}
+      max_zone_pool_size_(0),
+      target_mutator_utilization_(0) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -932,6 +933,15 @@ void SetResourceConstraints(i::Isolate* isolate,
                                    code_range_size);
   }
   isolate->allocator()->ConfigureSegmentPool(max_pool_size);
+  double target_mutator_utilization = constraints.target_mutator_utilization();
+  if (target_mutator_utilization != 0 &&
+      Utils::ApiCheck(
+          0 < target_mutator_utilization && target_mutator_utilization < 1,
+          "v8::ResourceConstraints::set_target_mutator_utilization",
+          "Target mutator utilization must be between 0 and 1 exclusive")) {
+    isolate->heap()->ConfigureTargetMutatorUtilization(
+        target_mutator_utilization);
+  }
 
   if (constraints.stack_limit() != nullptr) {
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
@@ -1986,6 +1996,12 @@ ScriptCompiler::StreamedSource::StreamedSource(ExternalSourceStream* stream,
     : impl_(new i::StreamedSource(stream, encoding)) {}
 
 
+ScriptCompiler::StreamedSource::StreamedSource(ExternalSourceStream* stream,
+                                               Encoding encoding,
+                                               CachedData* cached_data)
+    : impl_(new i::StreamedSource(stream, encoding, cached_data)) {}
+
+
 ScriptCompiler::StreamedSource::~StreamedSource() { delete impl_; }
 
 
@@ -2275,6 +2291,52 @@ MaybeLocal<Value> Module::Evaluate(Local<Context> context) {
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+// The parts of a script's origin that Compiler::GetSharedFunctionInfoForScript
+// takes as separate arguments, with the defaults for the unset ones.
+struct ScriptDetails {
+  explicit ScriptDetails(i::Isolate* isolate)
+      : host_defined_options(isolate->factory()->empty_fixed_array()),
+        line_offset(0),
+        column_offset(0) {}
+
+  i::MaybeHandle<i::Object> name_obj;
+  i::MaybeHandle<i::Object> source_map_url;
+  i::MaybeHandle<i::FixedArray> host_defined_options;
+  int line_offset;
+  int column_offset;
+};
+
+ScriptDetails GetScriptDetails(i::Isolate* isolate, Local<Value> resource_name,
+                               Local<Integer> resource_line_offset,
+                               Local<Integer> resource_column_offset,
+                               Local<Value> source_map_url,
+                               Local<PrimitiveArray> host_defined_options) {
+  ScriptDetails script_details(isolate);
+  if (!resource_name.IsEmpty()) {
+    script_details.name_obj = Utils::OpenHandle(*(resource_name));
+  }
+  if (!host_defined_options.IsEmpty()) {
+    script_details.host_defined_options =
+        Utils::OpenHandle(*(host_defined_options));
+  }
+  if (!resource_line_offset.IsEmpty()) {
+    script_details.line_offset =
+        static_cast<int>(resource_line_offset->Value());
+  }
+  if (!resource_column_offset.IsEmpty()) {
+    script_details.column_offset =
+        static_cast<int>(resource_column_offset->Value());
+  }
+  if (!source_map_url.IsEmpty()) {
+    script_details.source_map_url = Utils::OpenHandle(*(source_map_url));
+  }
+  return script_details;
+}
+
+}  // namespace
+
 MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     Isolate* v8_isolate, Source* source, CompileOptions options) {
   auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -2304,33 +2366,17 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   {
     i::HistogramTimerScope total(isolate->counters()->compile_script(), true);
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileScript");
-    i::MaybeHandle<i::Object> name_obj;
-    i::MaybeHandle<i::Object> source_map_url;
-    i::MaybeHandle<i::FixedArray> host_defined_options =
-        isolate->factory()->empty_fixed_array();
-    int line_offset = 0;
-    int column_offset = 0;
-    if (!source->resource_name.IsEmpty()) {
-      name_obj = Utils::OpenHandle(*(source->resource_name));
-    }
-    if (!source->host_defined_options.IsEmpty()) {
-      host_defined_options = Utils::OpenHandle(*(source->host_defined_options));
-    }
-    if (!source->resource_line_offset.IsEmpty()) {
-      line_offset = static_cast<int>(source->resource_line_offset->Value());
-    }
-    if (!source->resource_column_offset.IsEmpty()) {
-      column_offset =
-          static_cast<int>(source->resource_column_offset->Value());
-    }
-    if (!source->source_map_url.IsEmpty()) {
-      source_map_url = Utils::OpenHandle(*(source->source_map_url));
-    }
+    ScriptDetails script_details = GetScriptDetails(
+        isolate, source->resource_name, source->resource_line_offset,
+        source->resource_column_offset, source->source_map_url,
+        source->host_defined_options);
     i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
         i::Compiler::GetSharedFunctionInfoForScript(
-            str, name_obj, line_offset, column_offset, source->resource_options,
-            source_map_url, isolate->native_context(), nullptr, &script_data,
-            options, i::NOT_NATIVES_CODE, host_defined_options);
+            str, script_details.name_obj, script_details.line_offset,
+            script_details.column_offset, source->resource_options,
+            script_details.source_map_url, isolate->native_context(), nullptr,
+            &script_data, options, i::NOT_NATIVES_CODE,
+            script_details.host_defined_options);
     has_pending_exception = !maybe_function_info.ToHandle(&result);
     if (has_pending_exception && script_data != nullptr) {
       // This case won't happen during normal operation; we have compiled
@@ -2576,6 +2622,10 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
   if (!i::FLAG_script_streaming) {
     return nullptr;
   }
+  Utils::ApiCheck(
+      options != kConsumeCodeCache || source->GetCachedData() != nullptr,
+      "v8::ScriptCompiler::StartStreamingScript",
+      "kConsumeCodeCache requires a StreamedSource with cached data");
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   return new i::BackgroundParsingTask(source->impl(), options,
                                       i::FLAG_stack_size, isolate);
@@ -2590,6 +2640,34 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   TRACE_EVENT0("v8", "V8.ScriptCompiler");
   i::StreamedSource* source = v8_source->impl();
   i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::ScriptData* code_cache = source->consumed_code_cache.get();
+  if (code_cache != nullptr && code_cache->verified()) {
+    // The background task skipped parsing; deserialize the cache, falling back
+    // to a regular compile if it does not match this isolate or source.
+    ScriptDetails script_details = GetScriptDetails(
+        isolate, origin.ResourceName(), origin.ResourceLineOffset(),
+        origin.ResourceColumnOffset(), origin.SourceMapUrl(),
+        origin.HostDefinedOptions());
+    i::Handle<i::SharedFunctionInfo> result;
+    i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScript(
+            str, script_details.name_obj, script_details.line_offset,
+            script_details.column_offset, origin.Options(),
+            script_details.source_map_url, isolate->native_context(), nullptr,
+            &code_cache, kConsumeCodeCache, i::NOT_NATIVES_CODE,
+            script_details.host_defined_options);
+    source->cached_data->rejected = code_cache->rejected();
+    has_pending_exception = !maybe_function_info.ToHandle(&result);
+    source->Release();
+    RETURN_ON_FAILED_EXECUTION(Script);
+
+    Local<UnboundScript> generic = ToApiHandle<UnboundScript>(result);
+    if (generic.IsEmpty()) return Local<Script>();
+    Local<Script> bound = generic->BindToCurrentContext();
+    if (bound.IsEmpty()) return Local<Script>();
+    RETURN_ESCAPED(bound);
+  }
+
   i::Handle<i::Script> script = isolate->factory()->NewScript(str);
   if (!origin.ResourceName().IsEmpty()) {
     script->set_name(*Utils::OpenHandle(*(origin.ResourceName())));
@@ -2625,7 +2703,8 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   if (source->info->literal() != nullptr) {
     // Parsing has succeeded.
     result = i::Compiler::GetSharedFunctionInfoForStreamedScript(
-        script, source->info.get(), str->length());
+        script, source->info.get(), str->length(),
+        std::move(source->outer_function_job), &source->inner_function_jobs);
   }
   has_pending_exception = result.is_null();
   if (has_pending_exception) isolate->ReportPendingMessages();
@@ -2652,6 +2731,46 @@ Local<Script> ScriptCompiler::Compile(Isolate* v8_isolate,
 }
 
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
+    Local<UnboundScript> unbound_script, Local<String> source) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
+  base::ElapsedTimer timer;
+  if (i::FLAG_profile_deserialization) {
+    timer.Start();
+  }
+  i::HistogramTimerScope histogram_timer(
+      isolate->counters()->compile_serialize());
+  i::RuntimeCallTimerScope runtimeTimer(
+      isolate, &i::RuntimeCallStats::CompileSerialize);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileSerialize");
+
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Script::cast(shared->script()));
+  // Asm.js modules hold context-dependent wasm data, and break points or
+  // coverage state must not end up in the cache.
+  if (script->ContainsAsmModule()) return nullptr;
+  if (isolate->debug()->is_loaded()) return nullptr;
+
+  i::ScriptData* script_data =
+      i::CodeSerializer::Serialize(isolate, shared, Utils::OpenHandle(*source));
+  CachedData* result = new CachedData(
+      script_data->data(), script_data->length(), CachedData::BufferOwned);
+  script_data->ReleaseDataOwnership();
+  delete script_data;
+
+  if (i::FLAG_profile_deserialization) {
+    i::PrintF("[Serializing took %0.3f ms]\n",
+              timer.Elapsed().InMillisecondsF());
+  }
+
+  return result;
+}
+
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -6486,6 +6605,7 @@ HeapStatistics::HeapStatistics()
       heap_size_limit_(0),
       malloced_memory_(0),
       peak_malloced_memory_(0),
+      external_memory_(0),
       does_zap_garbage_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
@@ -8597,6 +8717,18 @@ void Isolate::SetGetExternallyAllocatedMemoryInBytesCallback(
   isolate->heap()->SetGetExternallyAllocatedMemoryInBytesCallback(callback);
 }
 
+void Isolate::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                       void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->AddNearHeapLimitCallback(callback, data);
+}
+
+void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                          size_t heap_limit) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
+}
+
 void Isolate::TerminateExecution() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->stack_guard()->RequestTerminateExecution();
@@ -8831,6 +8963,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
       isolate->allocator()->GetCurrentMemoryUsage();
   heap_statistics->peak_malloced_memory_ =
       isolate->allocator()->GetMaxMemoryUsage();
+  heap_statistics->external_memory_ =
+      static_cast<size_t>(i::Max<int64_t>(heap->external_memory(), 0));
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
 }
 
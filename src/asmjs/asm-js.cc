@@ -189,7 +189,7 @@ class AsmJsCompilationJob final : public CompilationJob {
   explicit AsmJsCompilationJob(ParseInfo* parse_info, FunctionLiteral* literal,
                                Isolate* isolate)
       : CompilationJob(parse_info->stack_limit(), parse_info,
-                       &compilation_info_, "AsmJs"),
+                       &compilation_info_, "AsmJs", State::kReadyToExecute),
         zone_(isolate->allocator(), ZONE_NAME),
         compilation_info_(&zone_, isolate, parse_info, literal),
         module_(nullptr),
@@ -216,7 +216,7 @@ class AsmJsCompilationJob final : public CompilationJob {
 };
 
 CompilationJob::Status AsmJsCompilationJob::PrepareJobImpl() {
-  return SUCCEEDED;
+  UNREACHABLE();  // Prepare should always be skipped.
 }
 
 CompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
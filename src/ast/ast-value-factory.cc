@@ -350,7 +350,12 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 
 void AstValueFactory::Internalize(Isolate* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. The string table is grown once up front, so that inserting them
+  // does not rehash it repeatedly. Strings that already exist in the table
+  // make this an overestimate, which only costs some unused capacity.
+  if (strings_count_ > 0) {
+    StringTable::EnsureCapacityForInsertions(isolate, strings_count_);
+  }
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
     current->Internalize(isolate);
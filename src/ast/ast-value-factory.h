@@ -374,6 +374,7 @@ class AstValueFactory {
         values_(nullptr),
         strings_(nullptr),
         strings_end_(&strings_),
+        strings_count_(0),
         cons_strings_(nullptr),
         cons_strings_end_(&cons_strings_),
         string_constants_(string_constants),
@@ -440,6 +441,7 @@ class AstValueFactory {
   AstRawString* AddString(AstRawString* string) {
     *strings_end_ = string;
     strings_end_ = string->next_location();
+    strings_count_++;
     return string;
   }
   AstConsString* AddConsString(AstConsString* string) {
@@ -450,6 +452,7 @@ class AstValueFactory {
   void ResetStrings() {
     strings_ = nullptr;
     strings_end_ = &strings_;
+    strings_count_ = 0;
     cons_strings_ = nullptr;
     cons_strings_end_ = &cons_strings_;
   }
@@ -469,6 +472,7 @@ class AstValueFactory {
   // members to be internalized first.
   AstRawString* strings_;
   AstRawString** strings_end_;
+  int strings_count_;
   AstConsString* cons_strings_;
   AstConsString** cons_strings_end_;
 
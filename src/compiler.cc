@@ -6,11 +6,15 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "src/api.h"
 #include "src/asmjs/asm-js.h"
 #include "src/assembler-inl.h"
 #include "src/ast/ast-numbering.h"
+#include "src/ast/ast-traversal-visitor.h"
 #include "src/ast/prettyprinter.h"
 #include "src/ast/scopes.h"
 #include "src/base/optional.h"
@@ -160,6 +164,16 @@ void CompilationJob::RecordOptimizedCompilationStats() const {
   double ms_creategraph = time_taken_to_prepare_.InMillisecondsF();
   double ms_optimize = time_taken_to_execute_.InMillisecondsF();
   double ms_codegen = time_taken_to_finalize_.InMillisecondsF();
+  // Prepare and finalize always run on the main thread, while execute may run
+  // on a background thread; record them separately so that the main-thread
+  // share of optimizing compilation is visible.
+  Counters* counters = compilation_info()->isolate()->counters();
+  counters->turbofan_optimize_prepare()->AddSample(
+      static_cast<int>(time_taken_to_prepare_.InMicroseconds()));
+  counters->turbofan_optimize_execute()->AddSample(
+      static_cast<int>(time_taken_to_execute_.InMicroseconds()));
+  counters->turbofan_optimize_finalize()->AddSample(
+      static_cast<int>(time_taken_to_finalize_.InMicroseconds()));
   if (FLAG_trace_opt) {
     PrintF("[optimizing ");
     function->ShortPrint();
@@ -347,26 +361,26 @@ bool Renumber(ParseInfo* parse_info,
                                 parse_info->literal(), eager_literals);
 }
 
-std::unique_ptr<CompilationJob> PrepareAndExecuteUnoptimizedCompileJob(
+// Unoptimized compilation jobs start out ready to execute, so this can run on
+// a background thread.
+std::unique_ptr<CompilationJob> ExecuteUnoptimizedCompileJob(
     ParseInfo* parse_info, FunctionLiteral* literal, Isolate* isolate) {
   if (UseAsmWasm(literal, parse_info->is_asm_wasm_broken())) {
     std::unique_ptr<CompilationJob> asm_job(
         AsmJs::NewCompilationJob(parse_info, literal, isolate));
-    if (asm_job->PrepareJob() == CompilationJob::SUCCEEDED &&
-        asm_job->ExecuteJob() == CompilationJob::SUCCEEDED) {
+    if (asm_job->ExecuteJob() == CompilationJob::SUCCEEDED) {
       return asm_job;
     }
     // asm.js validation failed, fall through to standard unoptimized compile.
     // Note: we rely on the fact that AsmJs jobs have done all validation in the
-    // PrepareJob and ExecuteJob phases and can't fail in FinalizeJob with
-    // with a validation error or another error that could be solve by falling
-    // through to standard unoptimized compile.
+    // ExecuteJob phase and can't fail in FinalizeJob with a validation error
+    // or another error that could be solve by falling through to standard
+    // unoptimized compile.
   }
   std::unique_ptr<CompilationJob> job(
       interpreter::Interpreter::NewCompilationJob(parse_info, literal,
                                                   isolate));
-  if (job->PrepareJob() == CompilationJob::SUCCEEDED &&
-      job->ExecuteJob() == CompilationJob::SUCCEEDED) {
+  if (job->ExecuteJob() == CompilationJob::SUCCEEDED) {
     return job;
   }
   return std::unique_ptr<CompilationJob>();  // Compilation failed, return null.
@@ -391,16 +405,15 @@ std::unique_ptr<CompilationJob> GenerateUnoptimizedCode(
 
   // Prepare and execute compilation of the outer-most function.
   std::unique_ptr<CompilationJob> outer_function_job(
-      PrepareAndExecuteUnoptimizedCompileJob(parse_info, parse_info->literal(),
-                                             isolate));
+      ExecuteUnoptimizedCompileJob(parse_info, parse_info->literal(),
+                                   isolate));
   if (!outer_function_job) return std::unique_ptr<CompilationJob>();
 
   // Prepare and execute compilation jobs for eager inner functions.
   for (auto it : inner_literals) {
     FunctionLiteral* inner_literal = it->value();
     std::unique_ptr<CompilationJob> inner_job(
-        PrepareAndExecuteUnoptimizedCompileJob(parse_info, inner_literal,
-                                               isolate));
+        ExecuteUnoptimizedCompileJob(parse_info, inner_literal, isolate));
     if (!inner_job) return std::unique_ptr<CompilationJob>();
     inner_function_jobs->emplace_front(std::move(inner_job));
   }
@@ -467,6 +480,11 @@ MUST_USE_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
         return Handle<Code>(code);
       }
     }
+  } else if (function->feedback_vector_cell()->value()->IsFeedbackVector()) {
+    // OSR code is cached per loop, so that re-entering a hot loop does not
+    // recompile it.
+    Code* code = function->feedback_vector()->GetOsrCode(osr_offset);
+    if (code != nullptr) return Handle<Code>(code);
   }
   return MaybeHandle<Code>();
 }
@@ -497,10 +515,12 @@ void InsertCodeIntoOptimizedCodeCache(CompilationInfo* compilation_info) {
   Handle<JSFunction> function = compilation_info->closure();
   Handle<SharedFunctionInfo> shared(function->shared());
   Handle<Context> native_context(function->context()->native_context());
+  Handle<FeedbackVector> vector =
+      handle(function->feedback_vector(), function->GetIsolate());
   if (compilation_info->osr_offset().IsNone()) {
-    Handle<FeedbackVector> vector =
-        handle(function->feedback_vector(), function->GetIsolate());
     FeedbackVector::SetOptimizedCode(vector, code);
+  } else {
+    FeedbackVector::SetOsrCode(vector, compilation_info->osr_offset(), code);
   }
 }
 
@@ -734,6 +754,121 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
   return CompilationJob::FAILED;
 }
 
+// Collects lazily parsed functions that the top-level code (or an eagerly
+// compiled function within it) calls directly or passes as a call argument,
+// i.e. functions likely to run as soon as the script does.
+class SpeculativeCompileCandidateFinder final
+    : public AstTraversalVisitor<SpeculativeCompileCandidateFinder> {
+ public:
+  SpeculativeCompileCandidateFinder(Isolate* isolate, FunctionLiteral* root)
+      : AstTraversalVisitor(isolate, root), root_(root) {}
+
+  const std::vector<FunctionLiteral*>& candidates() const {
+    return candidates_;
+  }
+
+  void VisitFunctionDeclaration(FunctionDeclaration* decl) {
+    if (decl->proxy()->is_resolved()) {
+      declared_functions_[decl->proxy()->var()] = decl->fun();
+    }
+    AstTraversalVisitor::VisitFunctionDeclaration(decl);
+  }
+
+  void VisitFunctionLiteral(FunctionLiteral* expr) {
+    // Calls in the bodies of lazy functions do not run with the script.
+    if (expr != root_ && !expr->ShouldEagerCompile()) return;
+    AstTraversalVisitor::VisitFunctionLiteral(expr);
+  }
+
+  void VisitCall(Call* expr) {
+    AddCandidate(expr->expression());
+    ZoneList<Expression*>* args = expr->arguments();
+    for (int i = 0; i < args->length(); ++i) AddCandidate(args->at(i));
+    AstTraversalVisitor::VisitCall(expr);
+  }
+
+ private:
+  void AddCandidate(Expression* expr) {
+    FunctionLiteral* literal = nullptr;
+    if (expr->IsFunctionLiteral()) {
+      literal = expr->AsFunctionLiteral();
+    } else if (expr->IsVariableProxy() &&
+               expr->AsVariableProxy()->is_resolved()) {
+      auto it = declared_functions_.find(expr->AsVariableProxy()->var());
+      if (it != declared_functions_.end()) literal = it->second;
+    }
+    if (literal == nullptr || !literal->scope()->was_lazily_parsed()) return;
+    if (!seen_.insert(literal).second) return;
+    candidates_.push_back(literal);
+  }
+
+  FunctionLiteral* root_;
+  std::unordered_map<Variable*, FunctionLiteral*> declared_functions_;
+  std::unordered_set<FunctionLiteral*> seen_;
+  std::vector<FunctionLiteral*> candidates_;
+};
+
+// Hands functions that are likely to be called soon after the script starts
+// running to the compiler dispatcher, so that they are parsed and compiled on
+// background threads instead of lazily on the main thread.
+void EnqueueSpeculativeCompileJobs(ParseInfo* parse_info, Isolate* isolate) {
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (!dispatcher->IsEnabled()) return;
+  Handle<Script> script = parse_info->script();
+  SpeculativeCompileCandidateFinder finder(isolate, parse_info->literal());
+  finder.Run();
+  if (finder.HasStackOverflow()) return;
+
+  int enqueued = 0;
+  for (FunctionLiteral* literal : finder.candidates()) {
+    if (enqueued == FLAG_speculative_compile_max_functions) break;
+    Handle<SharedFunctionInfo> shared;
+    if (!script->FindSharedFunctionInfo(isolate, literal).ToHandle(&shared) ||
+        shared->is_compiled()) {
+      continue;
+    }
+    if (dispatcher->EnqueueAndStep(shared)) enqueued++;
+  }
+}
+
+MaybeHandle<SharedFunctionInfo> FinalizeTopLevel(
+    ParseInfo* parse_info, Isolate* isolate,
+    CompilationJob* outer_function_job,
+    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs) {
+  Handle<Script> script = parse_info->script();
+
+  // Internalize ast values onto the heap.
+  parse_info->ast_value_factory()->Internalize(isolate);
+
+  // Create shared function infos for top level and shared function infos array
+  // for inner functions.
+  EnsureSharedFunctionInfosArrayOnScript(parse_info, isolate);
+  DCHECK_EQ(kNoSourcePosition,
+            parse_info->literal()->function_token_position());
+  Handle<SharedFunctionInfo> shared_info =
+      isolate->factory()->NewSharedFunctionInfoForLiteral(parse_info->literal(),
+                                                          parse_info->script());
+  shared_info->set_is_toplevel(true);
+
+  // Finalize compilation of the unoptimized bytecode or asm-js data.
+  if (!FinalizeUnoptimizedCode(parse_info, isolate, shared_info,
+                               outer_function_job, inner_function_jobs)) {
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  if (!script.is_null()) {
+    script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
+  }
+
+  if (FLAG_speculative_compile_max_functions > 0 && !parse_info->is_eval() &&
+      !script.is_null()) {
+    EnqueueSpeculativeCompileJobs(parse_info, isolate);
+  }
+
+  return shared_info;
+}
+
 MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
                                                 Isolate* isolate) {
   TimerEventScope<TimerEventCompileCode> top_level_timer(isolate);
@@ -744,8 +879,6 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
       isolate, parse_info->is_eval() ? &RuntimeCallStats::CompileEval
                                      : &RuntimeCallStats::CompileScript);
 
-  Handle<Script> script = parse_info->script();
-  Handle<SharedFunctionInfo> result;
   VMState<BYTECODE_COMPILER> state(isolate);
   if (parse_info->literal() == nullptr &&
       !parsing::ParseProgram(parse_info, isolate)) {
@@ -770,32 +903,8 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
     return MaybeHandle<SharedFunctionInfo>();
   }
 
-  // Internalize ast values onto the heap.
-  parse_info->ast_value_factory()->Internalize(isolate);
-
-  // Create shared function infos for top level and shared function infos array
-  // for inner functions.
-  EnsureSharedFunctionInfosArrayOnScript(parse_info, isolate);
-  DCHECK_EQ(kNoSourcePosition,
-            parse_info->literal()->function_token_position());
-  Handle<SharedFunctionInfo> shared_info =
-      isolate->factory()->NewSharedFunctionInfoForLiteral(parse_info->literal(),
-                                                          parse_info->script());
-  shared_info->set_is_toplevel(true);
-
-  // Finalize compilation of the unoptimized bytecode or asm-js data.
-  if (!FinalizeUnoptimizedCode(parse_info, isolate, shared_info,
-                               outer_function_job.get(),
-                               &inner_function_jobs)) {
-    if (!isolate->has_pending_exception()) isolate->StackOverflow();
-    return MaybeHandle<SharedFunctionInfo>();
-  }
-
-  if (!script.is_null()) {
-    script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
-  }
-
-  return shared_info;
+  return FinalizeTopLevel(parse_info, isolate, outer_function_job.get(),
+                          &inner_function_jobs);
 }
 
 bool FailWithPendingException(Isolate* isolate,
@@ -1131,15 +1240,6 @@ MaybeHandle<JSFunction> Compiler::GetFunctionFromEval(
 
 namespace {
 
-bool ContainsAsmModule(Handle<Script> script) {
-  DisallowHeapAllocation no_gc;
-  SharedFunctionInfo::ScriptIterator iter(script);
-  while (SharedFunctionInfo* info = iter.Next()) {
-    if (info->HasAsmWasmData()) return true;
-  }
-  return false;
-}
-
 bool ShouldProduceCodeCache(ScriptCompiler::CompileOptions options) {
   return options == ScriptCompiler::kProduceCodeCache ||
          options == ScriptCompiler::kProduceFullCodeCache;
@@ -1327,7 +1427,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       compilation_cache->PutScript(source, context, language_mode, result,
                                    vector);
       if (ShouldProduceCodeCache(compile_options) &&
-          !ContainsAsmModule(script)) {
+          !script->ContainsAsmModule()) {
         HistogramTimerScope histogram_timer(
             isolate->counters()->compile_serialize());
         RuntimeCallTimerScope runtimeTimer(isolate,
@@ -1353,18 +1453,48 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   return maybe_result;
 }
 
+std::unique_ptr<CompilationJob> Compiler::CompileTopLevelOnBackgroundThread(
+    ParseInfo* parse_info, Isolate* isolate,
+    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs) {
+  DCHECK_NOT_NULL(parse_info->literal());
+  DCHECK(!parse_info->is_eval());
+  // The parser already applied --use-strict, see BackgroundParsingTask.
+  DCHECK_EQ(parse_info->language_mode(),
+            stricter_language_mode(parse_info->language_mode(),
+                                   construct_language_mode(FLAG_use_strict)));
+  return GenerateUnoptimizedCode(parse_info, isolate, inner_function_jobs);
+}
+
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForStreamedScript(
-    Handle<Script> script, ParseInfo* parse_info, int source_length) {
+    Handle<Script> script, ParseInfo* parse_info, int source_length,
+    std::unique_ptr<CompilationJob> outer_function_job,
+    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs) {
   Isolate* isolate = script->GetIsolate();
   // TODO(titzer): increment the counters in caller.
   isolate->counters()->total_load_size()->Increment(source_length);
   isolate->counters()->total_compile_size()->Increment(source_length);
 
+  Handle<SharedFunctionInfo> result;
+  if (outer_function_job) {
+    // Bytecode was generated on the background thread; only finalize here.
+    TimerEventScope<TimerEventCompileCode> top_level_timer(isolate);
+    PostponeInterruptsScope postpone(isolate);
+    RuntimeCallTimerScope runtimeTimer(isolate,
+                                       &RuntimeCallStats::CompileScript);
+    VMState<BYTECODE_COMPILER> state(isolate);
+    HistogramTimerScope timer(isolate->counters()->compile());
+    if (FinalizeTopLevel(parse_info, isolate, outer_function_job.get(),
+                         inner_function_jobs)
+            .ToHandle(&result)) {
+      isolate->debug()->OnAfterCompile(script);
+    }
+    return result;
+  }
+
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   parse_info->set_language_mode(
       stricter_language_mode(parse_info->language_mode(), language_mode));
 
-  Handle<SharedFunctionInfo> result;
   if (CompileToplevel(parse_info, isolate).ToHandle(&result)) {
     isolate->debug()->OnAfterCompile(script);
   }
@@ -1441,13 +1571,8 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
 CompilationJob* Compiler::PrepareUnoptimizedCompilationJob(
     ParseInfo* parse_info, Isolate* isolate) {
   VMState<BYTECODE_COMPILER> state(isolate);
-  std::unique_ptr<CompilationJob> job(
-      interpreter::Interpreter::NewCompilationJob(
-          parse_info, parse_info->literal(), isolate));
-  if (job->PrepareJob() != CompilationJob::SUCCEEDED) {
-    return nullptr;
-  }
-  return job.release();
+  return interpreter::Interpreter::NewCompilationJob(
+      parse_info, parse_info->literal(), isolate);
 }
 
 bool Compiler::FinalizeCompilationJob(CompilationJob* raw_job) {
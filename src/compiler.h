@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_H_
 #define V8_COMPILER_H_
 
+#include <forward_list>
 #include <memory>
 
 #include "src/allocation.h"
@@ -53,7 +54,8 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool CompileOptimized(Handle<JSFunction> function, ConcurrencyMode);
   static MaybeHandle<JSArray> CompileForLiveEdit(Handle<Script> script);
 
-  // Prepare a compilation job for unoptimized code. Requires ParseAndAnalyse.
+  // Create a compilation job for unoptimized code, ready to be executed on any
+  // thread. Requires ParseAndAnalyse.
   static CompilationJob* PrepareUnoptimizedCompilationJob(ParseInfo* parse_info,
                                                           Isolate* isolate);
 
@@ -116,10 +118,22 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       NativesFlag is_natives_code,
       MaybeHandle<FixedArray> maybe_host_defined_options);
 
+  // Analyze a script parsed on a background thread and generate bytecode for
+  // its top-level code and eager inner functions, without touching the heap.
+  // Returns the job for the top-level code, or null on failure (e.g. stack
+  // overflow), in which case the script is compiled on the main thread.
+  static std::unique_ptr<CompilationJob> CompileTopLevelOnBackgroundThread(
+      ParseInfo* parse_info, Isolate* isolate,
+      std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs);
+
   // Create a shared function info object for a Script that has already been
-  // parsed while the script was being loaded from a streamed source.
+  // parsed while the script was being loaded from a streamed source. If
+  // {outer_function_job} is given, the script was also compiled in the
+  // background and only needs finalization.
   static Handle<SharedFunctionInfo> GetSharedFunctionInfoForStreamedScript(
-      Handle<Script> script, ParseInfo* info, int source_length);
+      Handle<Script> script, ParseInfo* info, int source_length,
+      std::unique_ptr<CompilationJob> outer_function_job,
+      std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs);
 
   // Create a shared function info object (the code may be lazily compiled).
   static Handle<SharedFunctionInfo> GetSharedFunctionInfo(FunctionLiteral* node,
@@ -2233,6 +2233,41 @@ Handle<Code> PipelineImpl::ScheduleAndGenerateCode(
   return FinalizeCode();
 }
 
+namespace {
+
+// Summarizes the quality of the register assignment: how many stack slots the
+// allocator had to spill to and how many gap moves survived move
+// optimization, in total and within loops.
+void PrintRegisterAllocationStats(std::ostream& os, PipelineData* data) {
+  InstructionSequence* sequence = data->sequence();
+  size_t gap_moves = 0;
+  size_t loop_gap_moves = 0;
+  for (const InstructionBlock* block : sequence->instruction_blocks()) {
+    bool in_loop = block->IsLoopHeader() || block->loop_header().IsValid();
+    for (int index = block->code_start(); index < block->code_end(); ++index) {
+      const Instruction* instr = sequence->InstructionAt(index);
+      for (int i = Instruction::FIRST_GAP_POSITION;
+           i <= Instruction::LAST_GAP_POSITION; ++i) {
+        const ParallelMove* moves =
+            instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+        if (moves == nullptr) continue;
+        for (const MoveOperands* move : *moves) {
+          if (move->IsRedundant()) continue;
+          ++gap_moves;
+          if (in_loop) ++loop_gap_moves;
+        }
+      }
+    }
+  }
+  os << "[register allocation stats for " << data->debug_name()
+     << ": instructions=" << sequence->instructions().size()
+     << " spill_slots=" << data->frame()->GetSpillSlotCount()
+     << " gap_moves=" << gap_moves << " loop_gap_moves=" << loop_gap_moves
+     << "]" << std::endl;
+}
+
+}  // namespace
+
 void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                      CallDescriptor* descriptor,
                                      bool run_verifier) {
@@ -2302,6 +2337,13 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   Run<LocateSpillSlotsPhase>();
 
+  if (FLAG_trace_turbo_alloc_stats) {
+    AllowHandleDereference allow_deref;
+    CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
+    OFStream os(tracing_scope.file());
+    PrintRegisterAllocationStats(os, data);
+  }
+
   if (FLAG_trace_turbo_graph) {
     AllowHandleDereference allow_deref;
     CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
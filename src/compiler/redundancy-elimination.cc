@@ -162,6 +162,45 @@ Node* RedundancyElimination::EffectPathChecks::LookupBoundsCheckFor(
   return nullptr;
 }
 
+namespace {
+
+// Checks whether the bounds check {a} makes the bounds check {b} redundant,
+// i.e. whether both check against the same length and every value of {b}'s
+// index is known to be in the range [0, x] for any index x that passed {a}.
+bool BoundsCheckSubsumes(Node* a, Node* b) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, a->opcode());
+  DCHECK_EQ(IrOpcode::kCheckBounds, b->opcode());
+  if (a->InputAt(1) != b->InputAt(1)) return false;
+  Node* const a_index = a->InputAt(0);
+  Node* const b_index = b->InputAt(0);
+  if (!NodeProperties::IsTyped(a_index) || !NodeProperties::IsTyped(b_index)) {
+    return false;
+  }
+  Type* const a_type = NodeProperties::GetType(a_index);
+  Type* const b_type = NodeProperties::GetType(b_index);
+  if (!a_type->Is(Type::Integral32()) || !a_type->IsInhabited()) return false;
+  if (!b_type->Is(Type::Integral32()) || !b_type->IsInhabited()) return false;
+  if (b_type->Min() < 0.0 || b_type->Max() > a_type->Min()) return false;
+  // Only drop {b} if its index is not less precise than {b} itself, so
+  // that no use of {b} observes a weaker type.
+  return !NodeProperties::IsTyped(b) ||
+         b_type->Is(NodeProperties::GetType(b));
+}
+
+}  // namespace
+
+Node* RedundancyElimination::EffectPathChecks::LookupSubsumingBoundsCheck(
+    Node* node) const {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  for (Check const* check = head_; check != nullptr; check = check->next) {
+    if (check->node->opcode() == IrOpcode::kCheckBounds &&
+        BoundsCheckSubsumes(check->node, node)) {
+      return check->node;
+    }
+  }
+  return nullptr;
+}
+
 RedundancyElimination::EffectPathChecks const*
 RedundancyElimination::PathChecksForEffectNodes::Get(Node* node) const {
   size_t const id = node->id();
@@ -187,6 +226,16 @@ Reduction RedundancyElimination::ReduceCheckNode(Node* node) {
     ReplaceWithValue(node, check);
     return Replace(check);
   }
+  // A bounds check against the same length with a larger index that is
+  // already known to have passed makes this one redundant; for example the
+  // check for a[3] also covers a[0] through a[2]. This also applies to checks
+  // inside a loop that are dominated by a check before the loop.
+  if (node->opcode() == IrOpcode::kCheckBounds &&
+      checks->LookupSubsumingBoundsCheck(node)) {
+    Node* const index = NodeProperties::GetValueInput(node, 0);
+    ReplaceWithValue(node, index);
+    return Replace(index);
+  }
 
   // Learn from this check.
   return UpdateChecks(node, checks->AddCheck(zone(), node));
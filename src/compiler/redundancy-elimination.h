@@ -37,6 +37,7 @@ class RedundancyElimination final : public AdvancedReducer {
     EffectPathChecks const* AddCheck(Zone* zone, Node* node) const;
     Node* LookupCheck(Node* node) const;
     Node* LookupBoundsCheckFor(Node* node) const;
+    Node* LookupSubsumingBoundsCheck(Node* node) const;
 
    private:
     EffectPathChecks(Check* head, size_t size) : head_(head), size_(size) {}
@@ -1159,9 +1159,36 @@ void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
 }
 
 
+// Blocks that end in a throw or a deoptimization are assumed to be cold, even
+// without a branch hint, so that the code generator places them out of line
+// together with the straight-line blocks that lead only to them. The walk stops
+// at blocks with several predecessors or successors, which keeps the schedule
+// within the deferred entry and exit path rules that the register allocator
+// relies on (see InstructionSequence::ValidateDeferredBlockEntryPaths).
+void Scheduler::MarkColdExitPathsDeferred() {
+  for (BasicBlock* block = schedule_->start(); block != nullptr;
+       block = block->rpo_next()) {
+    if (block->control() != BasicBlock::kThrow &&
+        block->control() != BasicBlock::kDeoptimize) {
+      continue;
+    }
+    BasicBlock* current = block;
+    while (current != schedule_->start() && !current->deferred() &&
+           current->PredecessorCount() == 1 &&
+           current->SuccessorCount() <= 1) {
+      TRACE("Marking cold block id:%d deferred\n", current->id().ToInt());
+      current->set_deferred(true);
+      current = current->PredecessorAt(0);
+    }
+  }
+}
+
+
 void Scheduler::GenerateImmediateDominatorTree() {
   TRACE("--- IMMEDIATE BLOCK DOMINATORS -----------------------------\n");
 
+  MarkColdExitPathsDeferred();
+
   // Seed start block to be the first dominator.
   schedule_->start()->set_dominator_depth(0);
 
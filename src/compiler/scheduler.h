@@ -95,6 +95,7 @@ class V8_EXPORT_PRIVATE Scheduler {
   void DecrementUnscheduledUseCount(Node* node, int index, Node* from);
 
   void PropagateImmediateDominators(BasicBlock* block);
+  void MarkColdExitPathsDeferred();
 
   // Phase 1: Build control-flow graph.
   friend class CFGBuilder;
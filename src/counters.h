@@ -1069,6 +1069,13 @@ class RuntimeCallTimerScope {
      MICROSECOND)
 
 #define TIMED_HISTOGRAM_LIST(HT)                                               \
+  /* Optimized compilation, split by the thread each phase runs on. */         \
+  HT(turbofan_optimize_prepare, V8.TurboFanOptimizePrepareMicroSeconds,        \
+     1000000, MICROSECOND)                                                     \
+  HT(turbofan_optimize_execute, V8.TurboFanOptimizeExecuteMicroSeconds,        \
+     1000000, MICROSECOND)                                                     \
+  HT(turbofan_optimize_finalize, V8.TurboFanOptimizeFinalizeMicroSeconds,      \
+     1000000, MICROSECOND)                                                     \
   HT(wasm_decode_asm_module_time, V8.WasmDecodeModuleMicroSeconds.asm,         \
      1000000, MICROSECOND)                                                     \
   HT(wasm_decode_wasm_module_time, V8.WasmDecodeModuleMicroSeconds.wasm,       \
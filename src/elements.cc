@@ -3202,12 +3202,28 @@ class TypedElementsAccessor
   static void CopyBetweenBackingStores(FixedTypedArrayBase* source,
                                        BackingStore* dest, size_t length,
                                        uint32_t offset) {
+    typedef typename SourceTraits::ElementType SourceType;
     FixedTypedArray<SourceTraits>* source_fta =
         FixedTypedArray<SourceTraits>::cast(source);
-    for (uint32_t i = 0; i < length; i++) {
-      typename SourceTraits::ElementType elem = source_fta->get_scalar(i);
-      dest->set(offset + i, dest->from(elem));
-    }
+    CHECK_LE(length, static_cast<size_t>(source_fta->length()));
+    CHECK_LE(offset + length, static_cast<size_t>(dest->length()));
+    // Work on the raw backing stores instead of going through get_scalar and
+    // set, which recompute the data pointer and bounds check every element.
+    // For integer widening and integer to floating point conversions the
+    // C++ compiler can vectorize the plain loop below; conversions to integer
+    // types from floating point or to Uint8Clamped still go through
+    // BackingStore::from per element. See the comment in
+    // FixedTypedArray<Traits>::get_scalar for the TSAN annotations.
+    const SourceType* source_data =
+        static_cast<const SourceType*>(source_fta->DataPtr());
+    ctype* dest_data = static_cast<ctype*>(dest->DataPtr()) + offset;
+    TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+    TSAN_ANNOTATE_IGNORE_WRITES_BEGIN;
+    for (size_t i = 0; i < length; i++) {
+      dest_data[i] = BackingStore::from(source_data[i]);
+    }
+    TSAN_ANNOTATE_IGNORE_WRITES_END;
+    TSAN_ANNOTATE_IGNORE_READS_END;
   }
 
   static void CopyElementsHandleFromTypedArray(Handle<JSTypedArray> source,
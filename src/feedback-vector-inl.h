@@ -78,6 +78,7 @@ int FeedbackMetadata::GetSlotSize(FeedbackSlotKind kind) {
 ACCESSORS(FeedbackVector, shared_function_info, SharedFunctionInfo,
           kSharedFunctionInfoOffset)
 ACCESSORS(FeedbackVector, optimized_code_cell, Object, kOptimizedCodeOffset)
+ACCESSORS(FeedbackVector, osr_code_cache, FixedArray, kOsrCodeCacheOffset)
 INT32_ACCESSORS(FeedbackVector, length, kLengthOffset)
 INT32_ACCESSORS(FeedbackVector, invocation_count, kInvocationCountOffset)
 INT32_ACCESSORS(FeedbackVector, profiler_ticks, kProfilerTicksOffset)
@@ -235,6 +235,7 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
   DCHECK_EQ(vector->shared_function_info(), *shared);
   DCHECK_EQ(vector->optimized_code_cell(),
             Smi::FromEnum(OptimizationMarker::kNone));
+  DCHECK_EQ(vector->osr_code_cache(), isolate->heap()->empty_fixed_array());
   DCHECK_EQ(vector->invocation_count(), 0);
   DCHECK_EQ(vector->profiler_ticks(), 0);
   DCHECK_EQ(vector->deopt_count(), 0);
@@ -345,6 +346,55 @@ void FeedbackVector::SetOptimizationMarker(OptimizationMarker marker) {
   set_optimized_code_cell(Smi::FromEnum(marker));
 }
 
+Code* FeedbackVector::GetOsrCode(BailoutId osr_offset) {
+  FixedArray* cache = osr_code_cache();
+  for (int i = 0; i < cache->length(); i += kOsrCodeCacheEntrySize) {
+    if (Smi::ToInt(cache->get(i + kOsrCodeCacheOffsetIndex)) !=
+        osr_offset.ToInt()) {
+      continue;
+    }
+    WeakCell* cell = WeakCell::cast(cache->get(i + kOsrCodeCacheCodeIndex));
+    if (cell->cleared()) return nullptr;
+    Code* code = Code::cast(cell->value());
+    // Stale entries are reused by the next SetOsrCode.
+    if (code->marked_for_deoptimization()) return nullptr;
+    return code;
+  }
+  return nullptr;
+}
+
+// static
+void FeedbackVector::SetOsrCode(Handle<FeedbackVector> vector,
+                                BailoutId osr_offset, Handle<Code> code) {
+  DCHECK_EQ(code->kind(), Code::OPTIMIZED_FUNCTION);
+  Isolate* isolate = vector->GetIsolate();
+  Factory* factory = isolate->factory();
+  Handle<WeakCell> cell = factory->NewWeakCell(code);
+  Handle<FixedArray> cache(vector->osr_code_cache(), isolate);
+
+  // Reuse the entry for the same loop, or one whose code is gone.
+  for (int i = 0; i < cache->length(); i += kOsrCodeCacheEntrySize) {
+    WeakCell* old_cell =
+        WeakCell::cast(cache->get(i + kOsrCodeCacheCodeIndex));
+    if (Smi::ToInt(cache->get(i + kOsrCodeCacheOffsetIndex)) ==
+            osr_offset.ToInt() ||
+        old_cell->cleared() ||
+        Code::cast(old_cell->value())->marked_for_deoptimization()) {
+      cache->set(i + kOsrCodeCacheOffsetIndex, Smi::FromInt(osr_offset.ToInt()));
+      cache->set(i + kOsrCodeCacheCodeIndex, *cell);
+      return;
+    }
+  }
+
+  Handle<FixedArray> new_cache =
+      factory->CopyFixedArrayAndGrow(cache, kOsrCodeCacheEntrySize, TENURED);
+  int index = cache->length();
+  new_cache->set(index + kOsrCodeCacheOffsetIndex,
+                 Smi::FromInt(osr_offset.ToInt()));
+  new_cache->set(index + kOsrCodeCacheCodeIndex, *cell);
+  vector->set_osr_code_cache(*new_cache);
+}
+
 void FeedbackVector::ClearOptimizedCode() {
   set_optimized_code_cell(Smi::FromEnum(OptimizationMarker::kNone));
 }
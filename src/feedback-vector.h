@@ -19,6 +19,8 @@
 namespace v8 {
 namespace internal {
 
+class BailoutId;
+
 enum class FeedbackSlotKind {
   // This kind means that the slot points to the middle of other slot
   // which occupies more than one feedback vector element.
@@ -146,6 +148,10 @@ class FeedbackVector : public HeapObject {
   // defining optimization behaviour.
   DECL_ACCESSORS(optimized_code_cell, Object)
 
+  // [osr_code_cache]: Code optimized for on-stack replacement, stored as pairs
+  // of OSR bytecode offset (Smi) and WeakCell holding the code.
+  DECL_ACCESSORS(osr_code_cache, FixedArray)
+
   // [length]: The length of the feedback vector (not including the header, i.e.
   // the number of feedback slots).
   DECL_INT32_ACCESSORS(length)
@@ -174,6 +180,12 @@ class FeedbackVector : public HeapObject {
                                Handle<Code> code);
   void SetOptimizationMarker(OptimizationMarker marker);
 
+  // Looks up the OSR code compiled for the loop at {osr_offset}. Entries whose
+  // code was collected or marked for deoptimization are dropped.
+  Code* GetOsrCode(BailoutId osr_offset);
+  static void SetOsrCode(Handle<FeedbackVector> vector, BailoutId osr_offset,
+                         Handle<Code> code);
+
   // Conversion from a slot to an integer index to the underlying array.
   static int GetIndex(FeedbackSlot slot) { return slot.ToInt(); }
 
@@ -256,6 +268,7 @@ class FeedbackVector : public HeapObject {
   /* Header fields. */                       \
   V(kSharedFunctionInfoOffset, kPointerSize) \
   V(kOptimizedCodeOffset, kPointerSize)      \
+  V(kOsrCodeCacheOffset, kPointerSize)       \
   V(kLengthOffset, kInt32Size)               \
   V(kInvocationCountOffset, kInt32Size)      \
   V(kProfilerTicksOffset, kInt32Size)        \
@@ -267,6 +280,11 @@ class FeedbackVector : public HeapObject {
 
   static const int kHeaderSize =
       RoundUp<kPointerAlignment>(kUnalignedHeaderSize);
+
+  // Layout of an entry in the osr_code_cache.
+  static const int kOsrCodeCacheOffsetIndex = 0;
+  static const int kOsrCodeCacheCodeIndex = 1;
+  static const int kOsrCodeCacheEntrySize = 2;
   static const int kFeedbackSlotsOffset = kHeaderSize;
 
   class BodyDescriptor;
@@ -285,6 +285,10 @@ DEFINE_IMPLICATION(future, preparser_scope_analysis)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(eager_pretenuring, false,
+            "tenure allocation sites whose objects survive two consecutive "
+            "scavenges, even if the young generation is not at its maximum "
+            "capacity")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -386,6 +390,9 @@ DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
+DEFINE_BOOL(trace_turbo_alloc_stats, false,
+            "trace spill slots and gap moves left by TurboFan's register "
+            "allocator")
 DEFINE_BOOL(trace_alloc, false, "trace register allocator")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
@@ -564,6 +571,18 @@ DEFINE_INT(type_info_threshold, 25,
 DEFINE_INT(generic_ic_threshold, 30,
            "max percentage of megamorphic/generic ICs to allow optimization")
 DEFINE_INT(self_opt_count, 130, "call count before self-optimization")
+DEFINE_INT(ticks_before_optimization, 2,
+           "the number of times we have to go through the interrupt budget "
+           "before considering this function for optimization")
+DEFINE_INT(bytecode_size_allowance_per_tick, 1200,
+           "increases the number of ticks required for optimization by "
+           "bytecode.length/X (0 disables the increase)")
+DEFINE_INT(max_bytecode_size_for_early_opt, 90,
+           "maximum bytecode length for a function to be optimized on the "
+           "first tick")
+DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
+           "maximum bytecode size to be considered for optimization; too "
+           "high values may cause the compiler to hit (release) assertions")
 
 // Garbage collections flags.
 DEFINE_INT(min_semi_space_size, 0,
@@ -626,6 +645,8 @@ DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free array buffer allocations on a background thread")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -663,6 +684,10 @@ DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_INT(compaction_pause_budget_ms, 0,
+           "limit the evacuation work selected for a full GC so that it is "
+           "expected to finish within the given number of milliseconds "
+           "(0 = use the default evacuation quota)")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -724,6 +749,10 @@ DEFINE_BOOL(enable_regexp_unaligned_accesses, true,
 
 // api.cc
 DEFINE_BOOL(script_streaming, true, "enable parsing on background")
+DEFINE_BOOL(background_compile, false,
+            "also generate bytecode for streamed scripts on the background "
+            "thread")
+DEFINE_IMPLICATION(background_compile, script_streaming)
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -786,6 +815,9 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
+DEFINE_INT(speculative_compile_max_functions, 0,
+           "maximum number of functions called from top-level code to "
+           "compile on the compiler dispatcher ahead of their first call")
 
 // compiler-dispatcher-job.cc
 DEFINE_BOOL(
@@ -1236,6 +1268,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_store_buffer)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_freeing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, minor_mc_parallel_marking)
 
 #undef FLAG
@@ -650,6 +650,19 @@ void GlobalHandles::IterateNewSpaceStrongAndDependentRoots(RootVisitor* v) {
   }
 }
 
+void GlobalHandles::IterateNewSpaceStrongAndDependentRoots(RootVisitor* v,
+                                                           size_t start,
+                                                           size_t end) {
+  for (size_t i = start; i < end; ++i) {
+    Node* node = new_space_nodes_[i];
+    if (node->IsStrongRetainer() ||
+        (node->IsWeakRetainer() && !node->is_independent() &&
+         node->is_active())) {
+      v->VisitRootPointer(Root::kGlobalHandles, node->location());
+    }
+  }
+}
+
 void GlobalHandles::IterateNewSpaceStrongAndDependentRootsAndIdentifyUnmodified(
     RootVisitor* v, size_t start, size_t end) {
   for (size_t i = start; i < end; ++i) {
@@ -148,6 +148,11 @@ class GlobalHandles {
   // Iterates over strong and dependent handles. See the note above.
   void IterateNewSpaceStrongAndDependentRoots(RootVisitor* v);
 
+  // Iterates over strong and dependent handles in the range [start, end) of
+  // the new space nodes. Different ranges can be processed in parallel.
+  void IterateNewSpaceStrongAndDependentRoots(RootVisitor* v, size_t start,
+                                              size_t end);
+
   // Iterates over strong and dependent handles. See the note above.
   // Also marks unmodified nodes in the same iteration.
   void IterateNewSpaceStrongAndDependentRootsAndIdentifyUnmodified(
@@ -0,0 +1,66 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/array-buffer-collector.h"
+
+#include "src/cancelable-task.h"
+#include "src/heap/heap.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class ArrayBufferCollector::FreeingTask final : public CancelableTask {
+ public:
+  explicit FreeingTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  virtual ~FreeingTask() {}
+
+ private:
+  void RunInternal() final {
+    heap_->array_buffer_collector()->FreeAllocations();
+  }
+
+  Heap* heap_;
+
+  DISALLOW_COPY_AND_ASSIGN(FreeingTask);
+};
+
+void ArrayBufferCollector::AddGarbageAllocations(
+    std::vector<JSArrayBuffer::Allocation>&& allocations) {
+  if (allocations.empty()) return;
+  base::LockGuard<base::Mutex> guard(&allocations_mutex_);
+  allocations_.push_back(std::move(allocations));
+}
+
+void ArrayBufferCollector::FreeAllocationsOnBackgroundThread() {
+  {
+    base::LockGuard<base::Mutex> guard(&allocations_mutex_);
+    if (allocations_.empty()) return;
+  }
+  if (FLAG_concurrent_array_buffer_freeing) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new FreeingTask(heap_), v8::Platform::kShortRunningTask);
+  } else {
+    FreeAllocations();
+  }
+}
+
+void ArrayBufferCollector::FreeAllocations() {
+  std::vector<std::vector<JSArrayBuffer::Allocation>> allocations;
+  {
+    base::LockGuard<base::Mutex> guard(&allocations_mutex_);
+    allocations.swap(allocations_);
+  }
+  Isolate* isolate = heap_->isolate();
+  for (const std::vector<JSArrayBuffer::Allocation>& list : allocations) {
+    for (const JSArrayBuffer::Allocation& allocation : list) {
+      JSArrayBuffer::FreeBackingStore(isolate, allocation);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,50 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
+#define V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
+
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/objects/js-array.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// To lower the latency of the GC, freeing of array buffer backing stores is
+// moved to a background thread. The GC hands over the allocations of dead
+// array buffers, which are freed once the GC is done.
+class ArrayBufferCollector {
+ public:
+  explicit ArrayBufferCollector(Heap* heap) : heap_(heap) {}
+
+  ~ArrayBufferCollector() { FreeAllocations(); }
+
+  // Queues the allocations of dead array buffers for freeing. Can be called
+  // concurrently from GC tasks.
+  void AddGarbageAllocations(
+      std::vector<JSArrayBuffer::Allocation>&& allocations);
+
+  // Frees all queued allocations on a background thread, or on the calling
+  // thread if --concurrent-array-buffer-freeing is off.
+  void FreeAllocationsOnBackgroundThread();
+
+ private:
+  class FreeingTask;
+
+  // Frees all queued allocations on the calling thread.
+  void FreeAllocations();
+
+  Heap* heap_;
+  base::Mutex allocations_mutex_;
+  std::vector<std::vector<JSArrayBuffer::Allocation>> allocations_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/heap/array-buffer-tracker.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/spaces.h"
@@ -20,6 +21,7 @@ void LocalArrayBufferTracker::Process(Callback callback) {
   JSArrayBuffer* old_buffer = nullptr;
   size_t new_retained_size = 0;
   size_t moved_size = 0;
+  std::vector<JSArrayBuffer::Allocation> backing_stores_to_free;
   for (TrackingData::iterator it = array_buffers_.begin();
        it != array_buffers_.end();) {
     old_buffer = reinterpret_cast<JSArrayBuffer*>(*it);
@@ -45,12 +47,19 @@ void LocalArrayBufferTracker::Process(Callback callback) {
       it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
       // Size of freed memory is computed to avoid looking at dead objects.
-      old_buffer->FreeBackingStore();
+      // The backing store itself is freed by the ArrayBufferCollector after
+      // the GC.
+      if (old_buffer->allocation_base() != nullptr) {
+        backing_stores_to_free.push_back(old_buffer->GetAllocation());
+        old_buffer->FreeBackingStore(false);
+      }
       it = array_buffers_.erase(it);
     } else {
       UNREACHABLE();
     }
   }
+  heap_->array_buffer_collector()->AddGarbageAllocations(
+      std::move(backing_stores_to_free));
   const size_t freed_memory = retained_size_ - new_retained_size - moved_size;
   if (freed_memory > 0) {
     heap_->update_external_memory_concurrently_freed(
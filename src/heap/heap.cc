@@ -23,6 +23,7 @@
 #include "src/deoptimizer.h"
 #include "src/feedback-vector.h"
 #include "src/global-handles.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/barrier.h"
 #include "src/heap/code-stats.h"
@@ -156,6 +157,7 @@ Heap::Heap()
       initial_old_generation_size_(max_old_generation_size_ /
                                    kInitalOldGenerationLimitFactor),
       old_generation_size_configured_(false),
+      target_mutator_utilization_(kTargetMutatorUtilization),
       // Variables set based on semispace_size_ and old_generation_size_ in
       // ConfigureHeap.
       // Will be 4 * reserved_semispace_size_ to ensure that young
@@ -211,6 +213,7 @@ Heap::Heap()
       dead_object_stats_(nullptr),
       scavenge_job_(nullptr),
       parallel_scavenge_semaphore_(0),
+      array_buffer_collector_(nullptr),
       idle_scavenge_observer_(nullptr),
       new_space_allocation_counter_(0),
       old_generation_allocation_counter_at_last_gc_(0),
@@ -704,8 +707,11 @@ inline bool MakePretenureDecision(
        current_decision == AllocationSite::kMaybeTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity. With --eager-pretenuring, a site that already had
+      // a high survival rate in the previous GC is tenured right away.
+      if (maximum_size_scavenge ||
+          (FLAG_eager_pretenuring &&
+           current_decision == AllocationSite::kMaybeTenure)) {
         site->set_deopt_dependent_code(true);
         site->set_pretenure_decision(AllocationSite::kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -720,6 +726,15 @@ inline bool MakePretenureDecision(
   return false;
 }
 
+// Estimates the number of bytes that were copied for objects of the given
+// site which survived the last GC. Only the size of the literal boilerplate
+// is known, so this is a lower bound for sites of literals and zero for other
+// sites.
+size_t EstimateSurvivedBytes(AllocationSite* site, int found_count) {
+  if (!site->PointsToLiteral()) return 0;
+  return static_cast<size_t>(found_count) * site->boilerplate()->Size();
+}
+
 inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
                                       bool maximum_size_scavenge) {
   bool deopt = false;
@@ -741,10 +756,11 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
   if (FLAG_trace_pretenuring_statistics) {
     PrintIsolate(isolate,
                  "pretenuring: AllocationSite(%p): (created, found, ratio) "
-                 "(%d, %d, %f) %s => %s\n",
+                 "(%d, %d, %f) %s => %s survived=%" PRIuS "\n",
                  static_cast<void*>(site), create_count, found_count, ratio,
                  site->PretenureDecisionName(current_decision),
-                 site->PretenureDecisionName(site->pretenure_decision()));
+                 site->PretenureDecisionName(site->pretenure_decision()),
+                 EstimateSurvivedBytes(site, found_count));
   }
 
   // Clear feedback calculation fields until the next gc.
@@ -770,6 +786,9 @@ void Heap::ProcessPretenuringFeedback() {
     int allocation_mementos_found = 0;
     int allocation_sites = 0;
     int active_allocation_sites = 0;
+    // Bytes that survived from sites which got tenured in this GC. This is an
+    // estimate of the copying saved in future young generation GCs.
+    size_t newly_tenured_bytes = 0;
 
     AllocationSite* site = nullptr;
 
@@ -788,9 +807,16 @@ void Heap::ProcessPretenuringFeedback() {
         DCHECK(site->IsAllocationSite());
         active_allocation_sites++;
         allocation_mementos_found += found_count;
+        const AllocationSite::PretenureDecision decision_before =
+            site->pretenure_decision();
         if (DigestPretenuringFeedback(isolate_, site, maximum_size_scavenge)) {
           trigger_deoptimization = true;
         }
+        if (FLAG_trace_pretenuring_statistics &&
+            decision_before != AllocationSite::kTenure &&
+            site->pretenure_decision() == AllocationSite::kTenure) {
+          newly_tenured_bytes += EstimateSurvivedBytes(site, found_count);
+        }
         if (site->GetPretenureMode() == TENURED) {
           tenure_decisions++;
         } else {
@@ -825,10 +851,12 @@ void Heap::ProcessPretenuringFeedback() {
       PrintIsolate(isolate(),
                    "pretenuring: deopt_maybe_tenured=%d visited_sites=%d "
                    "active_sites=%d "
-                   "mementos=%d tenured=%d not_tenured=%d\n",
+                   "mementos=%d tenured=%d not_tenured=%d "
+                   "newly_tenured_survived=%" PRIuS "\n",
                    deopt_maybe_tenured ? 1 : 0, allocation_sites,
                    active_allocation_sites, allocation_mementos_found,
-                   tenure_decisions, dont_tenure_decisions);
+                   tenure_decisions, dont_tenure_decisions,
+                   newly_tenured_bytes);
     }
 
     global_pretenuring_feedback_.clear();
@@ -877,6 +905,8 @@ void Heap::GarbageCollectionEpilogue() {
   if (FLAG_check_handle_count) CheckHandleCount();
 #endif
 
+  array_buffer_collector()->FreeAllocationsOnBackgroundThread();
+
   UpdateMaximumCommitted();
 
   isolate_->counters()->alive_after_last_gc()->Set(
@@ -1081,6 +1111,7 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   // Therefore stop recollecting after several attempts.
   if (gc_reason == GarbageCollectionReason::kLastResort) {
     InvokeOutOfMemoryCallback();
+    InvokeNearHeapLimitCallback();
   }
   RuntimeCallTimerScope runtime_timer(
       isolate(), &RuntimeCallStats::GC_Custom_AllAvailableGarbage);
@@ -1675,11 +1706,18 @@ void Heap::MinorMarkCompact() {
   LOG(isolate_, ResourceEvent("MinorMarkCompact", "begin"));
 
   TRACE_GC(tracer(), GCTracer::Scope::MINOR_MC);
+  ConcurrentMarking::PauseScope pause_scope(concurrent_marking());
   AlwaysAllocateScope always_allocate(isolate());
   PauseAllocationObserversScope pause_observers(this);
   IncrementalMarking::PauseBlackAllocationScope pause_black_allocation(
       incremental_marking());
 
+  if (mark_compact_collector()->sweeper().sweeping_in_progress() &&
+      memory_allocator_->unmapper()->NumberOfDelayedChunks() >
+          static_cast<int>(new_space_->MaximumCapacity() / Page::kPageSize)) {
+    mark_compact_collector()->EnsureSweepingCompleted();
+  }
+
   minor_mark_compact_collector()->CollectGarbage();
 
   LOG(isolate_, ResourceEvent("MinorMarkCompact", "end"));
@@ -1805,17 +1843,47 @@ static bool IsLogging(Isolate* isolate) {
           isolate->heap_profiler()->is_tracking_object_moves());
 }
 
-class PageScavengingItem final : public ItemParallelJob::Item {
+class ScavengingItem : public ItemParallelJob::Item {
+ public:
+  virtual ~ScavengingItem() {}
+  virtual void Process(Scavenger* scavenger) = 0;
+};
+
+class PageScavengingItem final : public ScavengingItem {
  public:
   explicit PageScavengingItem(MemoryChunk* chunk) : chunk_(chunk) {}
   virtual ~PageScavengingItem() {}
 
-  void Process(Scavenger* scavenger) { scavenger->ScavengePage(chunk_); }
+  void Process(Scavenger* scavenger) final { scavenger->ScavengePage(chunk_); }
 
  private:
   MemoryChunk* const chunk_;
 };
 
+// Scavenges the objects referenced by a batch of new space global handles.
+class GlobalHandlesScavengingItem final : public ScavengingItem {
+ public:
+  GlobalHandlesScavengingItem(Heap* heap, GlobalHandles* global_handles,
+                              size_t start, size_t end)
+      : heap_(heap),
+        global_handles_(global_handles),
+        start_(start),
+        end_(end) {}
+  virtual ~GlobalHandlesScavengingItem() {}
+
+  void Process(Scavenger* scavenger) final {
+    RootScavengeVisitor visitor(heap_, scavenger);
+    global_handles_->IterateNewSpaceStrongAndDependentRoots(&visitor, start_,
+                                                            end_);
+  }
+
+ private:
+  Heap* const heap_;
+  GlobalHandles* const global_handles_;
+  const size_t start_;
+  const size_t end_;
+};
+
 class ScavengingTask final : public ItemParallelJob::Task {
  public:
   ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier)
@@ -1829,8 +1897,8 @@ class ScavengingTask final : public ItemParallelJob::Task {
     {
       barrier_->Start();
       TimedScope scope(&scavenging_time);
-      PageScavengingItem* item = nullptr;
-      while ((item = GetItem<PageScavengingItem>()) != nullptr) {
+      ScavengingItem* item = nullptr;
+      while ((item = GetItem<ScavengingItem>()) != nullptr) {
         item->Process(scavenger_);
         item->MarkFinished();
       }
@@ -1945,9 +2013,19 @@ void Heap::Scavenge() {
           &JSObject::IsUnmodifiedApiObject);
     }
     {
-      // Copy roots.
+      // Copy roots. Strong and dependent global handles are split into
+      // batches that are scavenged by the parallel tasks.
       TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS);
-      IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+      GlobalHandles* global_handles = isolate()->global_handles();
+      const size_t new_space_nodes = global_handles->NumberOfNewSpaceNodes();
+      for (size_t start = 0; start < new_space_nodes;
+           start += kGlobalHandlesScavengingBatchSize) {
+        const size_t end =
+            Min(start + kGlobalHandlesScavengingBatchSize, new_space_nodes);
+        job.AddItem(
+            new GlobalHandlesScavengingItem(this, global_handles, start, end));
+      }
+      IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_PARALLEL_SCAVENGE);
     }
     {
       // Weak collections are held strongly by the Scavenger.
@@ -3665,14 +3743,17 @@ AllocationResult Heap::CopyFeedbackVector(FeedbackVector* src) {
   // Eliminate the write barrier if possible.
   if (mode == SKIP_WRITE_BARRIER) {
     CopyBlock(result->address() + kPointerSize,
-              result->address() + kPointerSize,
+              src->address() + kPointerSize,
               FeedbackVector::SizeFor(len) - kPointerSize);
+    // The OSR code cache is updated in place, so it must not be shared.
+    result->set_osr_code_cache(empty_fixed_array(), SKIP_WRITE_BARRIER);
     return result;
   }
 
   // Slow case: Just copy the content one-by-one.
   result->set_shared_function_info(src->shared_function_info());
   result->set_optimized_code_cell(src->optimized_code_cell());
+  result->set_osr_code_cache(empty_fixed_array(), SKIP_WRITE_BARRIER);
   result->set_invocation_count(src->invocation_count());
   result->set_profiler_ticks(src->profiler_ticks());
   result->set_deopt_count(src->deopt_count());
@@ -3816,6 +3897,7 @@ AllocationResult Heap::AllocateFeedbackVector(SharedFunctionInfo* shared,
   FeedbackVector* vector = FeedbackVector::cast(result);
   vector->set_shared_function_info(shared);
   vector->set_optimized_code_cell(Smi::FromEnum(OptimizationMarker::kNone));
+  vector->set_osr_code_cache(empty_fixed_array(), SKIP_WRITE_BARRIER);
   vector->set_length(length);
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
@@ -4363,6 +4445,50 @@ void Heap::InvokeOutOfMemoryCallback() {
   }
 }
 
+void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                    void* data) {
+  const size_t kMaxCallbacks = 100;
+  CHECK_LT(near_heap_limit_callbacks_.size(), kMaxCallbacks);
+  for (auto callback_data : near_heap_limit_callbacks_) {
+    CHECK_NE(callback_data.first, callback);
+  }
+  near_heap_limit_callbacks_.push_back(std::make_pair(callback, data));
+}
+
+void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                       size_t heap_limit) {
+  for (size_t i = 0; i < near_heap_limit_callbacks_.size(); i++) {
+    if (near_heap_limit_callbacks_[i].first == callback) {
+      near_heap_limit_callbacks_.erase(near_heap_limit_callbacks_.begin() + i);
+      if (heap_limit) {
+        RestoreHeapLimit(heap_limit);
+      }
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+bool Heap::InvokeNearHeapLimitCallback() {
+  if (near_heap_limit_callbacks_.empty()) return false;
+  HandleScope scope(isolate());
+  v8::NearHeapLimitCallback callback = near_heap_limit_callbacks_.back().first;
+  void* data = near_heap_limit_callbacks_.back().second;
+  size_t heap_limit = callback(data, max_old_generation_size_,
+                               initial_max_old_generation_size_);
+  if (heap_limit > max_old_generation_size_) {
+    if (FLAG_trace_gc) {
+      isolate()->PrintWithTimestamp(
+          "Heap limit raised by near heap limit callback: %" PRIuS
+          " KB -> %" PRIuS " KB\n",
+          max_old_generation_size_ / KB, heap_limit / KB);
+    }
+    max_old_generation_size_ = heap_limit;
+    return true;
+  }
+  return false;
+}
+
 void Heap::CollectCodeStatistics() {
   CodeStatistics::ResetCodeAndMetadataStatistics(isolate());
   // We do not look for code in new space, or map space.  If code
@@ -4730,6 +4856,7 @@ void Heap::IterateRoots(RootVisitor* v, VisitMode mode) {
 
 void Heap::IterateWeakRoots(RootVisitor* v, VisitMode mode) {
   const bool isMinorGC = mode == VISIT_ALL_IN_SCAVENGE ||
+                         mode == VISIT_ALL_IN_PARALLEL_SCAVENGE ||
                          mode == VISIT_ALL_IN_MINOR_MC_MARK ||
                          mode == VISIT_ALL_IN_MINOR_MC_UPDATE;
   v->VisitRootPointer(Root::kStringTable, reinterpret_cast<Object**>(
@@ -4801,6 +4928,7 @@ class FixStaleLeftTrimmedHandlesVisitor : public RootVisitor {
 
 void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   const bool isMinorGC = mode == VISIT_ALL_IN_SCAVENGE ||
+                         mode == VISIT_ALL_IN_PARALLEL_SCAVENGE ||
                          mode == VISIT_ALL_IN_MINOR_MC_MARK ||
                          mode == VISIT_ALL_IN_MINOR_MC_UPDATE;
   v->VisitRootPointers(Root::kStrongRootList, &roots_[0],
@@ -4853,6 +4981,9 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
     case VISIT_ALL_IN_SCAVENGE:
       isolate_->global_handles()->IterateNewSpaceStrongAndDependentRoots(v);
       break;
+    case VISIT_ALL_IN_PARALLEL_SCAVENGE:
+      // Global handles are processed by the scavenging tasks.
+      break;
     case VISIT_ALL_IN_MINOR_MC_MARK:
       // Global handles are processed manually be the minor MC.
       break;
@@ -5018,6 +5149,13 @@ void Heap::GetFromRingBuffer(char* buffer) {
 
 bool Heap::ConfigureHeapDefault() { return ConfigureHeap(0, 0, 0); }
 
+void Heap::ConfigureTargetMutatorUtilization(
+    double target_mutator_utilization) {
+  DCHECK_LT(0.0, target_mutator_utilization);
+  DCHECK_GT(1.0, target_mutator_utilization);
+  target_mutator_utilization_ = target_mutator_utilization;
+}
+
 void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
   *stats->start_marker = HeapStats::kStartMarker;
   *stats->end_marker = HeapStats::kEndMarker;
@@ -5119,13 +5257,16 @@ const double Heap::kTargetMutatorUtilization = 0.97;
 //   F * (R * (1 - MU) - MU) / (R * (1 - MU)) = 1
 //   F = R * (1 - MU) / (R * (1 - MU) - MU)
 double Heap::HeapGrowingFactor(double gc_speed, double mutator_speed,
-                               double max_factor) {
+                               double max_factor,
+                               double target_mutator_utilization) {
   DCHECK_LE(kMinHeapGrowingFactor, max_factor);
   DCHECK_GE(kMaxHeapGrowingFactor, max_factor);
+  DCHECK_LT(0.0, target_mutator_utilization);
+  DCHECK_GT(1.0, target_mutator_utilization);
   if (gc_speed == 0 || mutator_speed == 0) return max_factor;
 
   const double speed_ratio = gc_speed / mutator_speed;
-  const double mu = kTargetMutatorUtilization;
+  const double mu = target_mutator_utilization;
 
   const double a = speed_ratio * (1 - mu);
   const double b = speed_ratio * (1 - mu) - mu;
@@ -5189,14 +5330,15 @@ size_t Heap::MinimumAllocationLimitGrowingStep() {
 void Heap::SetOldGenerationAllocationLimit(size_t old_gen_size, double gc_speed,
                                            double mutator_speed) {
   double max_factor = MaxHeapGrowingFactor(max_old_generation_size_);
-  double factor = HeapGrowingFactor(gc_speed, mutator_speed, max_factor);
+  double factor = HeapGrowingFactor(gc_speed, mutator_speed, max_factor,
+                                    target_mutator_utilization_);
 
   if (FLAG_trace_gc_verbose) {
     isolate_->PrintWithTimestamp(
         "Heap growing factor %.1f based on mu=%.3f, speed_ratio=%.f "
         "(gc=%.f, mutator=%.f)\n",
-        factor, kTargetMutatorUtilization, gc_speed / mutator_speed, gc_speed,
-        mutator_speed);
+        factor, target_mutator_utilization_, gc_speed / mutator_speed,
+        gc_speed, mutator_speed);
   }
 
   if (memory_reducer_->ShouldGrowHeapSlowly() ||
@@ -5226,7 +5368,8 @@ void Heap::DampenOldGenerationAllocationLimit(size_t old_gen_size,
                                               double gc_speed,
                                               double mutator_speed) {
   double max_factor = MaxHeapGrowingFactor(max_old_generation_size_);
-  double factor = HeapGrowingFactor(gc_speed, mutator_speed, max_factor);
+  double factor = HeapGrowingFactor(gc_speed, mutator_speed, max_factor,
+                                    target_mutator_utilization_);
   size_t limit = CalculateOldGenerationAllocationLimit(factor, old_gen_size);
   if (limit < old_generation_allocation_limit_) {
     if (FLAG_trace_gc_verbose) {
@@ -5448,6 +5591,7 @@ bool Heap::SetUp() {
     dead_object_stats_ = new ObjectStats(this);
   }
   scavenge_job_ = new ScavengeJob();
+  array_buffer_collector_ = new ArrayBufferCollector(this);
   local_embedder_heap_tracer_ = new LocalEmbedderHeapTracer();
 
   LOG(isolate_, IntPtrTEvent("heap-capacity", Capacity()));
@@ -5613,6 +5757,10 @@ void Heap::TearDown() {
   delete scavenge_job_;
   scavenge_job_ = nullptr;
 
+  // Frees the remaining queued backing stores.
+  delete array_buffer_collector_;
+  array_buffer_collector_ = nullptr;
+
   isolate_->global_handles()->TearDown();
 
   external_string_table_.TearDown();
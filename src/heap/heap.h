@@ -366,6 +366,7 @@ using v8::MemoryPressureLevel;
   } while (false)
 
 class AllocationObserver;
+class ArrayBufferCollector;
 class ArrayBufferTracker;
 class ConcurrentMarking;
 class GCIdleTimeAction;
@@ -611,7 +612,7 @@ class Heap {
   static const double kMaxHeapGrowingFactorMemoryConstrained;
   static const double kMaxHeapGrowingFactorIdle;
   static const double kConservativeHeapGrowingFactor;
-  static const double kTargetMutatorUtilization;
+  V8_EXPORT_PRIVATE static const double kTargetMutatorUtilization;
 
   static const int kNoGCFlags = 0;
   static const int kReduceMemoryFootprintMask = 1;
@@ -694,9 +695,9 @@ class Heap {
 
   V8_EXPORT_PRIVATE static double MaxHeapGrowingFactor(
       size_t max_old_generation_size);
-  V8_EXPORT_PRIVATE static double HeapGrowingFactor(double gc_speed,
-                                                    double mutator_speed,
-                                                    double max_factor);
+  V8_EXPORT_PRIVATE static double HeapGrowingFactor(
+      double gc_speed, double mutator_speed, double max_factor,
+      double target_mutator_utilization = kTargetMutatorUtilization);
 
   // Copy block of memory from src to dst. Size of block should be aligned
   // by pointer size.
@@ -808,6 +809,10 @@ class Heap {
   void SetOutOfMemoryCallback(v8::debug::OutOfMemoryCallback callback,
                               void* data);
 
+  void AddNearHeapLimitCallback(v8::NearHeapLimitCallback, void* data);
+  void RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                   size_t heap_limit);
+
   double MonotonicallyIncreasingTimeInMs();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -908,11 +913,14 @@ class Heap {
   }
 
   void RestoreOriginalHeapLimit() {
+    RestoreHeapLimit(initial_max_old_generation_size_);
+  }
+
+  void RestoreHeapLimit(size_t heap_limit) {
     // Do not set the limit lower than the live size + some slack.
     size_t min_limit = SizeOfObjects() + SizeOfObjects() / 4;
     max_old_generation_size_ =
-        Min(max_old_generation_size_,
-            Max(initial_max_old_generation_size_, min_limit));
+        Min(max_old_generation_size_, Max(heap_limit, min_limit));
   }
 
   bool IsHeapLimitIncreasedForDebugging() {
@@ -933,6 +941,11 @@ class Heap {
                      size_t code_range_size_in_mb);
   bool ConfigureHeapDefault();
 
+  // Sets the mutator utilization that the heap growing strategy aims for,
+  // i.e., the fraction of time spent outside of the garbage collector.
+  // Higher values trade memory for fewer garbage collections.
+  void ConfigureTargetMutatorUtilization(double target_mutator_utilization);
+
   // Prepares the heap, setting up memory areas that are needed in the isolate
   // without actually creating any objects.
   bool SetUp();
@@ -991,6 +1004,10 @@ class Heap {
     return minor_mark_compact_collector_;
   }
 
+  ArrayBufferCollector* array_buffer_collector() {
+    return array_buffer_collector_;
+  }
+
   // ===========================================================================
   // Root set access. ==========================================================
   // ===========================================================================
@@ -1649,6 +1666,9 @@ class Heap {
 
   static const int kMaxScavengerTasks = 8;
 
+  // Number of new space global handles scavenged by a single work item.
+  static const size_t kGlobalHandlesScavengingBatchSize = 1000;
+
   Heap();
 
   static String* UpdateNewSpaceReferenceInExternalStringTableEntry(
@@ -1792,6 +1812,10 @@ class Heap {
 
   void InvokeOutOfMemoryCallback();
 
+  // Invokes the most recently added near heap limit callback. Returns true if
+  // the callback raised the heap limit.
+  bool InvokeNearHeapLimitCallback();
+
   void ComputeFastPromotionMode(double survival_rate);
 
   // Attempt to over-approximate the weak closure by marking object groups and
@@ -2223,6 +2247,7 @@ class Heap {
   size_t initial_max_old_generation_size_;
   size_t initial_old_generation_size_;
   bool old_generation_size_configured_;
+  double target_mutator_utilization_;
   size_t maximum_committed_;
 
   // For keeping track of how much data has survived
@@ -2243,6 +2268,9 @@ class Heap {
   v8::debug::OutOfMemoryCallback out_of_memory_callback_;
   void* out_of_memory_callback_data_;
 
+  std::vector<std::pair<v8::NearHeapLimitCallback, void*> >
+      near_heap_limit_callbacks_;
+
   // For keeping track of context disposals.
   int contexts_disposed_;
 
@@ -2364,6 +2392,8 @@ class Heap {
   ScavengeJob* scavenge_job_;
   base::Semaphore parallel_scavenge_semaphore_;
 
+  ArrayBufferCollector* array_buffer_collector_;
+
   AllocationObserver* idle_scavenge_observer_;
 
   // This counter is increased before each GC and never reset.
@@ -861,6 +861,16 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_pause_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // The traced compaction speed is per evacuator, so the quota scales with
+      // the number of tasks that evacuate pages in parallel.
+      const int tasks = FLAG_parallel_compaction ? NumberOfAvailableCores() : 1;
+      *max_evacuated_bytes = Max<size_t>(
+          area_size,
+          static_cast<size_t>(estimated_compaction_speed * tasks *
+                              FLAG_compaction_pause_budget_ms));
+    }
   }
 }
 
@@ -3215,6 +3215,14 @@ void PagedSpace::RepairFreeListsAfterDeserialization() {
 bool PagedSpace::SweepAndRetryAllocation(int size_in_bytes) {
   MarkCompactCollector* collector = heap()->mark_compact_collector();
   if (collector->sweeping_in_progress()) {
+    if (FLAG_concurrent_sweeping && !is_local()) {
+      // Sweep the remaining pages of this space on demand before blocking on
+      // the sweeper tasks, which may still be busy with other spaces.
+      collector->sweeper().ParallelSweepSpace(identity(), size_in_bytes);
+      RefillFreeList();
+      if (free_list_.Allocate(static_cast<size_t>(size_in_bytes))) return true;
+    }
+
     // Wait for the sweeper threads here and complete the sweeping phase.
     collector->EnsureSweepingCompleted();
 
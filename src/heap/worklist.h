@@ -19,8 +19,11 @@ namespace internal {
 
 // A concurrent worklist based on segments. Each tasks gets private
 // push and pop segments. Empty pop segments are swapped with their
-// corresponding push segments. Full push segments are published to a global
-// pool of segments and replaced with empty segments.
+// corresponding push segments. Full push segments are published to the
+// task's pool of segments and replaced with empty segments. A task that runs
+// out of work first takes segments from its own pool and then steals segments
+// from the pools of the other tasks. Each pool has its own lock, so tasks only
+// contend on a lock when stealing.
 //
 // Work stealing is best effort, i.e., there is no way to inform other tasks
 // of the need of items.
@@ -56,12 +59,16 @@ class Worklist {
     int task_id_;
   };
 
-  static const int kMaxNumTasks = 8;
+  // Enough for one marking or scavenging task per core on 16-core machines.
+  // Each task costs two private segments and one pool, so this only affects
+  // the footprint of worklists that are created with the default task count.
+  static const int kMaxNumTasks = 16;
   static const size_t kSegmentCapacity = SEGMENT_SIZE;
 
   Worklist() : Worklist(kMaxNumTasks) {}
 
   explicit Worklist(int num_tasks) : num_tasks_(num_tasks) {
+    DCHECK_LE(num_tasks_, kMaxNumTasks);
     for (int i = 0; i < num_tasks_; i++) {
       private_push_segment(i) = NewSegment();
       private_pop_segment(i) = NewSegment();
@@ -117,13 +124,20 @@ class Worklist {
            private_push_segment(task_id)->IsEmpty();
   }
 
-  bool IsGlobalPoolEmpty() { return global_pool_.IsEmpty(); }
+  // Only reads the top of each pool, so that drain loops do not write to
+  // cache lines that are shared between tasks.
+  bool IsGlobalPoolEmpty() {
+    for (int i = 0; i < num_tasks_; i++) {
+      if (!global_pool(i).IsEmpty()) return false;
+    }
+    return true;
+  }
 
   bool IsGlobalEmpty() {
     for (int i = 0; i < num_tasks_; i++) {
       if (!IsLocalEmpty(i)) return false;
     }
-    return global_pool_.IsEmpty();
+    return IsGlobalPoolEmpty();
   }
 
   size_t LocalSize(int task_id) {
@@ -138,8 +152,8 @@ class Worklist {
     for (int i = 0; i < num_tasks_; i++) {
       private_pop_segment(i)->Clear();
       private_push_segment(i)->Clear();
+      global_pool(i).Clear();
     }
-    global_pool_.Clear();
   }
 
   // Calls the specified callback on each element of the deques and replaces
@@ -155,13 +169,15 @@ class Worklist {
     for (int i = 0; i < num_tasks_; i++) {
       private_pop_segment(i)->Update(callback);
       private_push_segment(i)->Update(callback);
+      global_pool(i).Update(callback);
     }
-    global_pool_.Update(callback);
   }
 
   template <typename Callback>
   void IterateGlobalPool(Callback callback) {
-    global_pool_.Iterate(callback);
+    for (int i = 0; i < num_tasks_; i++) {
+      global_pool(i).Iterate(callback);
+    }
   }
 
   void FlushToGlobal(int task_id) {
@@ -169,9 +185,13 @@ class Worklist {
     PublishPopSegmentToGlobal(task_id);
   }
 
+  // Moves the segments of all pools of |other| into the pools of this
+  // worklist. Pool i of |other| is merged into pool (i % num_tasks_).
   void MergeGlobalPool(Worklist* other) {
-    auto pair = other->global_pool_.Extract();
-    global_pool_.MergeList(pair.first, pair.second);
+    for (int i = 0; i < other->num_tasks_; i++) {
+      auto pair = other->global_pool(i).Extract();
+      global_pool(i % num_tasks_).MergeList(pair.first, pair.second);
+    }
   }
 
  private:
@@ -340,6 +360,7 @@ class Worklist {
 
     base::Mutex lock_;
     Segment* top_;
+    char cache_line_padding[64];
   };
 
   V8_INLINE Segment*& private_push_segment(int task_id) {
@@ -350,27 +371,36 @@ class Worklist {
     return private_segments_[task_id].private_pop_segment;
   }
 
+  V8_INLINE GlobalPool& global_pool(int task_id) {
+    return global_pools_[task_id];
+  }
+
   V8_INLINE void PublishPushSegmentToGlobal(int task_id) {
     if (!private_push_segment(task_id)->IsEmpty()) {
-      global_pool_.Push(private_push_segment(task_id));
+      global_pool(task_id).Push(private_push_segment(task_id));
       private_push_segment(task_id) = NewSegment();
     }
   }
 
   V8_INLINE void PublishPopSegmentToGlobal(int task_id) {
     if (!private_pop_segment(task_id)->IsEmpty()) {
-      global_pool_.Push(private_pop_segment(task_id));
+      global_pool(task_id).Push(private_pop_segment(task_id));
       private_pop_segment(task_id) = NewSegment();
     }
   }
 
+  // Tries the pool of |task_id| first and then the pools of the other tasks
+  // in round-robin order, so that stealing tasks spread over the pools.
   V8_INLINE bool StealPopSegmentFromGlobal(int task_id) {
-    if (global_pool_.IsEmpty()) return false;
-    Segment* new_segment = nullptr;
-    if (global_pool_.Pop(&new_segment)) {
-      delete private_pop_segment(task_id);
-      private_pop_segment(task_id) = new_segment;
-      return true;
+    for (int i = 0; i < num_tasks_; i++) {
+      GlobalPool& pool = global_pool((task_id + i) % num_tasks_);
+      if (pool.IsEmpty()) continue;
+      Segment* new_segment = nullptr;
+      if (pool.Pop(&new_segment)) {
+        delete private_pop_segment(task_id);
+        private_pop_segment(task_id) = new_segment;
+        return true;
+      }
     }
     return false;
   }
@@ -381,7 +411,7 @@ class Worklist {
   }
 
   PrivateSegmentHolder private_segments_[kMaxNumTasks];
-  GlobalPool global_pool_;
+  GlobalPool global_pools_[kMaxNumTasks];
   int num_tasks_;
 };
 
@@ -58,10 +58,8 @@ class InterpreterCompilationJob final : public CompilationJob {
     DISALLOW_COPY_AND_ASSIGN(TimerScope);
   };
 
-  bool executed_on_background_thread() {
-    // TODO(rmcilroy): Fix once we create InterpreterCompilationJob on
-    // background thread.
-    return false;
+  bool executed_on_background_thread() const {
+    return executed_on_background_thread_;
   }
 
   BytecodeGenerator* generator() { return &generator_; }
@@ -71,6 +69,10 @@ class InterpreterCompilationJob final : public CompilationJob {
   BytecodeGenerator generator_;
   RuntimeCallStats* runtime_call_stats_;
   RuntimeCallCounter background_execute_counter_;
+  // Set by ExecuteJobImpl. Jobs for streamed scripts are created and executed
+  // on the streaming thread, which must not use the isolate's
+  // RuntimeCallStats.
+  bool executed_on_background_thread_;
 
   DISALLOW_COPY_AND_ASSIGN(InterpreterCompilationJob);
 };
@@ -173,19 +175,23 @@ InterpreterCompilationJob::InterpreterCompilationJob(ParseInfo* parse_info,
                                                      FunctionLiteral* literal,
                                                      Isolate* isolate)
     : CompilationJob(parse_info->stack_limit(), parse_info, &compilation_info_,
-                     "Ignition"),
+                     "Ignition", State::kReadyToExecute),
       zone_(isolate->allocator(), ZONE_NAME),
       compilation_info_(&zone_, isolate, parse_info, literal),
       generator_(&compilation_info_),
       runtime_call_stats_(isolate->counters()->runtime_call_stats()),
-      background_execute_counter_("CompileBackgroundIgnition") {}
+      background_execute_counter_("CompileBackgroundIgnition"),
+      executed_on_background_thread_(false) {}
 
 InterpreterCompilationJob::Status InterpreterCompilationJob::PrepareJobImpl() {
-  MaybePrintAst(parse_info(), compilation_info());
-  return SUCCEEDED;
+  // The job starts out ready to execute, so that it can be created and run on
+  // a background thread.
+  UNREACHABLE();
 }
 
 InterpreterCompilationJob::Status InterpreterCompilationJob::ExecuteJobImpl() {
+  executed_on_background_thread_ = !ThreadId::Current().Equals(
+      compilation_info()->isolate()->thread_id());
   TimerScope runtimeTimer(
       executed_on_background_thread() ? &background_execute_counter_ : nullptr);
   RuntimeCallTimerScope runtimeTimerScope(
@@ -204,6 +210,8 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::ExecuteJobImpl() {
 }
 
 InterpreterCompilationJob::Status InterpreterCompilationJob::FinalizeJobImpl() {
+  MaybePrintAst(parse_info(), compilation_info());
+
   // Add background runtime call stats.
   if (V8_UNLIKELY(FLAG_runtime_stats && executed_on_background_thread())) {
     runtime_call_stats_->CompileBackgroundIgnition.Add(
@@ -266,7 +266,8 @@ class FeedbackVector::BodyDescriptor final : public BodyDescriptorBase {
  public:
   static bool IsValidSlot(HeapObject* obj, int offset) {
     return offset == kSharedFunctionInfoOffset ||
-           offset == kOptimizedCodeOffset || offset >= kFeedbackSlotsOffset;
+           offset == kOptimizedCodeOffset || offset == kOsrCodeCacheOffset ||
+           offset >= kFeedbackSlotsOffset;
   }
 
   template <typename ObjectVisitor>
@@ -274,6 +275,7 @@ class FeedbackVector::BodyDescriptor final : public BodyDescriptorBase {
                                  ObjectVisitor* v) {
     IteratePointer(obj, kSharedFunctionInfoOffset, v);
     IteratePointer(obj, kOptimizedCodeOffset, v);
+    IteratePointer(obj, kOsrCodeCacheOffset, v);
     IteratePointers(obj, kFeedbackSlotsOffset, object_size, v);
   }
 
@@ -734,6 +734,7 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {  // NOLINT
 
   os << "\n SharedFunctionInfo: " << Brief(shared_function_info());
   os << "\n Optimized Code: " << Brief(optimized_code_cell());
+  os << "\n OSR Code Cache: " << Brief(osr_code_cache());
   os << "\n Invocation Count: " << invocation_count();
   os << "\n Profiler Ticks: " << profiler_ticks();
 
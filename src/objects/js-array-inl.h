@@ -102,6 +102,10 @@ ArrayBuffer::Allocator::AllocationMode JSArrayBuffer::allocation_mode() const {
                             : AllocationMode::kNormal;
 }
 
+JSArrayBuffer::Allocation JSArrayBuffer::GetAllocation() const {
+  return Allocation(allocation_base(), allocation_length(), allocation_mode());
+}
+
 void JSArrayBuffer::set_bit_field(uint32_t bits) {
   if (kInt32Size != kPointerSize) {
 #if V8_TARGET_LITTLE_ENDIAN
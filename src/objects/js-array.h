@@ -179,7 +179,26 @@ class JSArrayBuffer : public JSObject {
 
   inline ArrayBuffer::Allocator::AllocationMode allocation_mode() const;
 
-  void FreeBackingStore();
+  struct Allocation {
+    using AllocationMode = ArrayBuffer::Allocator::AllocationMode;
+
+    Allocation(void* allocation_base, size_t length, AllocationMode mode)
+        : allocation_base(allocation_base), length(length), mode(mode) {}
+
+    void* allocation_base;
+    size_t length;
+    AllocationMode mode;
+  };
+
+  // Returns the allocation of the backing store, which can be passed to
+  // FreeBackingStore after the backing store has been detached from this
+  // buffer with FreeBackingStore(false).
+  inline Allocation GetAllocation() const;
+
+  // Frees the backing store unless |free_memory| is false, and clears all
+  // references to it.
+  void FreeBackingStore(bool free_memory = true);
+  static void FreeBackingStore(Isolate* isolate, Allocation allocation);
 
   V8_EXPORT_PRIVATE static void Setup(
       Handle<JSArrayBuffer> array_buffer, Isolate* isolate, bool is_external,
@@ -115,6 +115,9 @@ class Script : public Struct {
 
   Object* GetNameOrSourceURL();
 
+  // Check if the script contains any Asm modules.
+  bool ContainsAsmModule();
+
   // Retrieve source position from where eval was called.
   int GetEvalPosition();
 
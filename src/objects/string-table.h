@@ -67,7 +67,9 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
       Isolate* isolate, uint16_t c1, uint16_t c2);
   static Object* LookupStringIfExists_NoAllocate(String* string);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the string table once so that |expected| new strings can be added
+  // without further resizing.
+  static void EnsureCapacityForInsertions(Isolate* isolate, int expected);
 
   DECL_CAST(StringTable)
 
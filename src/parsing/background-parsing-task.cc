@@ -4,31 +4,49 @@
 
 #include "src/parsing/background-parsing-task.h"
 
+#include "src/compiler.h"
 #include "src/objects-inl.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
 namespace internal {
 
 void StreamedSource::Release() {
+  outer_function_job.reset();
+  inner_function_jobs.clear();
   parser.reset();
   info.reset();
+  consumed_code_cache.reset();
 }
 
 BackgroundParsingTask::BackgroundParsingTask(
     StreamedSource* source, ScriptCompiler::CompileOptions options,
     int stack_size, Isolate* isolate)
-    : source_(source), stack_size_(stack_size), script_data_(nullptr) {
+    : source_(source),
+      stack_size_(stack_size),
+      script_data_(nullptr),
+      isolate_(isolate) {
   // We don't set the context to the CompilationInfo yet, because the background
   // thread cannot do anything with it anyway. We set it just before compilation
   // on the foreground thread.
   DCHECK(options == ScriptCompiler::kProduceParserCache ||
          options == ScriptCompiler::kProduceCodeCache ||
          options == ScriptCompiler::kProduceFullCodeCache ||
+         options == ScriptCompiler::kConsumeCodeCache ||
          options == ScriptCompiler::kNoCompileOptions);
 
+  if (options == ScriptCompiler::kConsumeCodeCache) {
+    DCHECK_NOT_NULL(source->cached_data);
+    // ScriptData takes care of pointer-aligning the data.
+    source->consumed_code_cache.reset(new ScriptData(
+        source->cached_data->data, source->cached_data->length));
+    // Should the cache be rejected, the script is parsed like an uncached one.
+    options = ScriptCompiler::kNoCompileOptions;
+  }
+
   VMState<PARSER> state(isolate);
 
   // Prepare the data for the internalization phase and compilation phase, which
@@ -41,6 +59,9 @@ BackgroundParsingTask::BackgroundParsingTask(
     info->set_runtime_call_stats(nullptr);
   }
   info->set_toplevel();
+  info->set_language_mode(
+      stricter_language_mode(info->language_mode(),
+                             construct_language_mode(FLAG_use_strict)));
   std::unique_ptr<Utf16CharacterStream> stream(
       ScannerStream::For(source->source_stream.get(), source->encoding,
                          info->runtime_call_stats()));
@@ -71,9 +92,35 @@ void BackgroundParsingTask::Run() {
   // background thread.
   uintptr_t stack_limit = GetCurrentStackPosition() - stack_size_ * KB;
   source_->parser->set_stack_limit(stack_limit);
+  source_->info->set_stack_limit(stack_limit);
+
+  if (source_->consumed_code_cache) {
+    // Check the checksum here rather than on the main thread. A cache that
+    // passes does not need to be parsed at all.
+    if (SerializedCodeData::Verify(source_->consumed_code_cache.get()) ==
+        SerializedCodeData::CHECK_SUCCESS) {
+      return;
+    }
+    source_->cached_data->rejected = true;
+  }
 
   source_->parser->ParseOnBackground(source_->info.get());
 
+  ParseInfo* info = source_->info.get();
+  if (FLAG_background_compile && info->literal() != nullptr &&
+      !(FLAG_validate_asm && info->literal()->scope()->ContainsAsmModule())) {
+    // asm.js modules are left to the main thread, which reports validation
+    // failures as messages.
+    source_->outer_function_job = Compiler::CompileTopLevelOnBackgroundThread(
+        info, isolate_, &source_->inner_function_jobs);
+    if (!source_->outer_function_job) {
+      // The AST has been rewritten in place and cannot be compiled again.
+      source_->inner_function_jobs.clear();
+      info->pending_error_handler()->set_stack_overflow();
+      info->set_literal(nullptr);
+    }
+  }
+
   if (script_data_ != nullptr) {
     source_->cached_data.reset(new ScriptCompiler::CachedData(
         script_data_->data(), script_data_->length(),
@@ -5,6 +5,7 @@
 #ifndef V8_PARSING_BACKGROUND_PARSING_TASK_H_
 #define V8_PARSING_BACKGROUND_PARSING_TASK_H_
 
+#include <forward_list>
 #include <memory>
 
 #include "include/v8.h"
@@ -16,6 +17,7 @@
 namespace v8 {
 namespace internal {
 
+class CompilationJob;
 class Parser;
 class ScriptData;
 
@@ -26,6 +28,12 @@ struct StreamedSource {
   StreamedSource(ScriptCompiler::ExternalSourceStream* source_stream,
                  ScriptCompiler::StreamedSource::Encoding encoding)
       : source_stream(source_stream), encoding(encoding) {}
+  StreamedSource(ScriptCompiler::ExternalSourceStream* source_stream,
+                 ScriptCompiler::StreamedSource::Encoding encoding,
+                 ScriptCompiler::CachedData* cached_data)
+      : source_stream(source_stream),
+        encoding(encoding),
+        cached_data(cached_data) {}
 
   void Release();
 
@@ -34,6 +42,11 @@ struct StreamedSource {
   ScriptCompiler::StreamedSource::Encoding encoding;
   std::unique_ptr<ScriptCompiler::CachedData> cached_data;
 
+  // Code cache to consume, set up when streaming with kConsumeCodeCache. It is
+  // verified on the background thread; if that succeeds, parsing is skipped
+  // and the code is deserialized when compiling on the main thread.
+  std::unique_ptr<ScriptData> consumed_code_cache;
+
   // Data needed for parsing, and data needed to to be passed between thread
   // between parsing and compilation. These need to be initialized before the
   // compilation starts.
@@ -41,6 +54,11 @@ struct StreamedSource {
   std::unique_ptr<ParseInfo> info;
   std::unique_ptr<Parser> parser;
 
+  // With --background-compile, the bytecode for the top-level code and its
+  // eager inner functions, which only needs finalizing on the main thread.
+  std::unique_ptr<CompilationJob> outer_function_job;
+  std::forward_list<std::unique_ptr<CompilationJob>> inner_function_jobs;
+
   // Prevent copying.
   StreamedSource(const StreamedSource&) = delete;
   StreamedSource& operator=(const StreamedSource&) = delete;
@@ -58,6 +76,7 @@ class BackgroundParsingTask : public ScriptCompiler::ScriptStreamingTask {
   StreamedSource* source_;  // Not owned.
   int stack_size_;
   ScriptData* script_data_;
+  Isolate* isolate_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -26,8 +26,12 @@ class ScriptData {
   const byte* data() const { return data_; }
   int length() const { return length_; }
   bool rejected() const { return rejected_; }
+  // Whether the isolate-independent part of the sanity check (including the
+  // payload checksum) has already been performed, e.g. on a background thread.
+  bool verified() const { return verified_; }
 
   void Reject() { rejected_ = true; }
+  void MarkVerified() { verified_ = true; }
 
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
@@ -42,6 +46,7 @@ class ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool verified_ : 1;
   const byte* data_;
   int length_;
 
@@ -456,6 +456,10 @@ Token::Value Scanner::SkipWhiteSpace() {
 
       // Advance as long as character is a WhiteSpace or LineTerminator.
       // Remember if the latter is the case.
+      if (c0_ == ' ' || c0_ == '\t') {
+        AdvanceUntil([](uc32 c0) { return c0 != ' ' && c0 != '\t'; });
+        continue;
+      }
       if (IsLineTerminator(c0_)) {
         has_line_terminator_before_next_ = true;
       } else if (!unicode_cache_->IsWhiteSpace(c0_)) {
@@ -513,8 +517,8 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
-    Advance();
+  if (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
+    AdvanceUntil([this](uc32 c0) { return IsLineTerminator(c0); });
   }
 
   return Token::WHITESPACE;
@@ -587,6 +591,12 @@ Token::Value Scanner::SkipMultiLineComment() {
   Advance();
 
   while (c0_ != kEndOfInput) {
+    // Only '*' and line terminators are interesting inside the comment.
+    if (c0_ != '*' && !IsLineTerminator(c0_)) {
+      AdvanceUntil(
+          [this](uc32 c0) { return c0 == '*' || IsLineTerminator(c0); });
+      if (c0_ == kEndOfInput) break;
+    }
     uc32 ch = c0_;
     Advance();
     if (c0_ != kEndOfInput && IsLineTerminator(ch)) {
@@ -1075,8 +1085,16 @@ Token::Value Scanner::ScanString() {
     }
     char c = static_cast<char>(c0_);
     if (c == '\\') break;
-    Advance<false, false>();
     AddLiteralChar(c);
+    // Take the rest of the run of plain ASCII characters from the buffer.
+    AdvanceUntil([this, quote](uc32 c0) {
+      if (c0 > kMaxAscii || c0 == quote || c0 == '\\' || c0 == '\n' ||
+          c0 == '\r') {
+        return true;
+      }
+      AddLiteralChar(static_cast<char>(c0));
+      return false;
+    });
   }
 
   while (c0_ != quote && c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
@@ -1533,23 +1551,22 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
   DCHECK(unicode_cache_->IsIdentifierStart(c0_));
   LiteralScope literal(this);
   if (IsInRange(c0_, 'a', 'z') || c0_ == '_') {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsInRange(c0_, 'a', 'z') || c0_ == '_');
+    AddLiteralChar(static_cast<char>(c0_));
+    AdvanceUntil([this](uc32 c0) {
+      if (!IsInRange(c0, 'a', 'z') && c0 != '_') return true;
+      AddLiteralChar(static_cast<char>(c0));
+      return false;
+    });
 
     if (IsDecimalDigit(c0_) || IsInRange(c0_, 'A', 'Z') || c0_ == '_' ||
         c0_ == '$') {
       // Identifier starting with lowercase.
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-      while (IsAsciiIdentifier(c0_)) {
-        char first_char = static_cast<char>(c0_);
-        Advance<false, false>();
-        AddLiteralChar(first_char);
-      }
+      AddLiteralChar(static_cast<char>(c0_));
+      AdvanceUntil([this](uc32 c0) {
+        if (!IsAsciiIdentifier(c0)) return true;
+        AddLiteralChar(static_cast<char>(c0));
+        return false;
+      });
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
         return Token::IDENTIFIER;
@@ -1568,11 +1585,12 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsAsciiIdentifier(c0_));
+    AddLiteralChar(static_cast<char>(c0_));
+    AdvanceUntil([this](uc32 c0) {
+      if (!IsAsciiIdentifier(c0)) return true;
+      AddLiteralChar(static_cast<char>(c0));
+      return false;
+    });
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
       literal.Complete();
@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,35 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past code units up to and including the first one for which
+  // {check} returns true, and returns that code unit, or kEndOfInput if there
+  // is none. The skipped code units are consumed straight from the buffer, so
+  // runs of uninteresting characters only pay for an inlined {check} instead
+  // of a call to Advance() and its buffer end check each. {check} is called
+  // once per code unit in order, so it may have side effects such as
+  // recording the skipped characters.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      if (V8_LIKELY(buffer_cursor_ < buffer_end_)) {
+        const uint16_t* next_cursor_pos =
+            std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t c) {
+              return check(static_cast<uc32>(c));
+            });
+        if (next_cursor_pos != buffer_end_) {
+          buffer_cursor_ = next_cursor_pos + 1;
+          return static_cast<uc32>(*next_cursor_pos);
+        }
+        buffer_cursor_ = buffer_end_;
+      }
+      if (!ReadBlockChecked()) {
+        // See Advance() for why the cursor moves past the end of input.
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -596,6 +627,15 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Makes the next character for which {check} holds the current one, skipping
+  // everything in between without capturing it. {check} sees single UTF-16
+  // code units; a lead surrogate it stops at is combined as in Advance().
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntil(FunctionType check) {
+    c0_ = source_->AdvanceUntil(check);
+    HandleLeadSurrogate();
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
@@ -26,29 +26,31 @@ HeapSnapshot* HeapGraphEdge::snapshot() const {
 }
 
 
-int HeapEntry::index() const {
-  return static_cast<int>(this - &snapshot_->entries().front());
-}
-
-
 int HeapEntry::set_children_index(int index) {
-  children_index_ = index;
+  // Note: children_count_ and children_end_index_ are parts of a union.
   int next_index = index + children_count_;
-  children_count_ = 0;
+  children_end_index_ = index;
   return next_index;
 }
 
-std::deque<HeapGraphEdge*>::iterator HeapEntry::children_begin() {
-  DCHECK_GE(children_index_, 0);
-  SLOW_DCHECK(
-      children_index_ < static_cast<int>(snapshot_->children().size()) ||
-      (children_index_ == static_cast<int>(snapshot_->children().size()) &&
-       children_count_ == 0));
-  return snapshot_->children().begin() + children_index_;
+void HeapEntry::add_child(HeapGraphEdge* edge) {
+  snapshot_->children()[children_end_index_++] = edge;
+}
+
+HeapGraphEdge* HeapEntry::child(int i) { return *(children_begin() + i); }
+
+int HeapEntry::children_count() const {
+  return static_cast<int>(children_end() - children_begin());
+}
+
+std::deque<HeapGraphEdge*>::iterator HeapEntry::children_begin() const {
+  return index_ == 0 ? snapshot_->children().begin()
+                     : snapshot_->entries()[index_ - 1].children_end();
 }
 
-std::deque<HeapGraphEdge*>::iterator HeapEntry::children_end() {
-  return children_begin() + children_count_;
+std::deque<HeapGraphEdge*>::iterator HeapEntry::children_end() const {
+  SLOW_DCHECK(children_end_index_ <= snapshot_->children().size());
+  return snapshot_->children().begin() + children_end_index_;
 }
 
 
@@ -52,14 +52,15 @@ void HeapGraphEdge::ReplaceToIndexWithEntry(HeapSnapshot* snapshot) {
 const int HeapEntry::kNoEntry = -1;
 
 HeapEntry::HeapEntry(HeapSnapshot* snapshot,
+                     int index,
                      Type type,
                      const char* name,
                      SnapshotObjectId id,
                      size_t self_size,
                      unsigned trace_node_id)
     : type_(type),
+      index_(index),
       children_count_(0),
-      children_index_(-1),
       self_size_(self_size),
       snapshot_(snapshot),
       name_(name),
@@ -247,7 +248,8 @@ HeapEntry* HeapSnapshot::AddEntry(HeapEntry::Type type,
                                   size_t size,
                                   unsigned trace_node_id) {
   DCHECK(sorted_entries_.empty());
-  entries_.emplace_back(this, type, name, id, size, trace_node_id);
+  entries_.emplace_back(this, static_cast<int>(entries_.size()), type, name,
+                        id, size, trace_node_id);
   return &entries_.back();
 }
 
@@ -723,7 +725,7 @@ class SnapshotFiller {
                                     int parent,
                                     HeapEntry* child_entry) {
     HeapEntry* parent_entry = &snapshot_->entries()[parent];
-    int index = parent_entry->children_count() + 1;
+    int index = parent_entry->added_children_count() + 1;
     parent_entry->SetIndexedReference(type, index, child_entry);
   }
   void SetNamedReference(HeapGraphEdge::Type type,
@@ -737,7 +739,7 @@ class SnapshotFiller {
                                   int parent,
                                   HeapEntry* child_entry) {
     HeapEntry* parent_entry = &snapshot_->entries()[parent];
-    int index = parent_entry->children_count() + 1;
+    int index = parent_entry->added_children_count() + 1;
     parent_entry->SetNamedReference(
         type,
         names_->GetName(index),
@@ -2633,7 +2635,7 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
 
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
-  std::vector<HeapEntry>& entries = snapshot_->entries();
+  std::deque<HeapEntry>& entries = snapshot_->entries();
   for (const HeapEntry& entry : entries) {
     SerializeNode(&entry);
     if (writer_->aborted()) return;
@@ -100,8 +100,8 @@ class HeapEntry BASE_EMBEDDED {
   };
   static const int kNoEntry;
 
-  HeapEntry() { }
   HeapEntry(HeapSnapshot* snapshot,
+            int index,
             Type type,
             const char* name,
             SnapshotObjectId id,
@@ -115,13 +115,15 @@ class HeapEntry BASE_EMBEDDED {
   SnapshotObjectId id() const { return id_; }
   size_t self_size() const { return self_size_; }
   unsigned trace_node_id() const { return trace_node_id_; }
-  INLINE(int index() const);
-  int children_count() const { return children_count_; }
+  int index() const { return index_; }
+  // Only valid after HeapSnapshot::FillChildren.
+  INLINE(int children_count() const);
+  // The number of edges added so far. Only valid while the snapshot is being
+  // built, i.e., before HeapSnapshot::FillChildren.
+  int added_children_count() const { return children_count_; }
   INLINE(int set_children_index(int index));
-  void add_child(HeapGraphEdge* edge) {
-    *(children_begin() + children_count_++) = edge;
-  }
-  HeapGraphEdge* child(int i) { return *(children_begin() + i); }
+  INLINE(void add_child(HeapGraphEdge* edge));
+  INLINE(HeapGraphEdge* child(int i));
   INLINE(Isolate* isolate() const);
 
   void SetIndexedReference(
@@ -133,13 +135,19 @@ class HeapEntry BASE_EMBEDDED {
       const char* prefix, const char* edge_name, int max_depth, int indent);
 
  private:
-  INLINE(std::deque<HeapGraphEdge*>::iterator children_begin());
-  INLINE(std::deque<HeapGraphEdge*>::iterator children_end());
+  INLINE(std::deque<HeapGraphEdge*>::iterator children_begin() const);
+  INLINE(std::deque<HeapGraphEdge*>::iterator children_end() const);
   const char* TypeAsString();
 
   unsigned type_: 4;
-  int children_count_: 28;
-  int children_index_;
+  unsigned index_ : 28;  // Supports up to ~250M objects.
+  union {
+    // The count is used while the snapshot is being built, then it gets
+    // converted into the end index of the children by FillChildren. The
+    // children of an entry start at the end index of the previous entry.
+    unsigned children_count_;
+    unsigned children_end_index_;
+  };
   size_t self_size_;
   HeapSnapshot* snapshot_;
   const char* name_;
@@ -165,7 +173,7 @@ class HeapSnapshot {
   HeapEntry* gc_subroot(int index) {
     return &entries_[gc_subroot_indexes_[index]];
   }
-  std::vector<HeapEntry>& entries() { return entries_; }
+  std::deque<HeapEntry>& entries() { return entries_; }
   std::deque<HeapGraphEdge>& edges() { return edges_; }
   std::deque<HeapGraphEdge*>& children() { return children_; }
   void RememberLastJSObjectId();
@@ -194,7 +202,10 @@ class HeapSnapshot {
   int root_index_;
   int gc_roots_index_;
   int gc_subroot_indexes_[VisitorSynchronization::kNumberOfSyncTags];
-  std::vector<HeapEntry> entries_;
+  // Entries are kept in a deque rather than a vector, so that a growing
+  // snapshot neither copies all entries nor temporarily holds two copies of
+  // them. HeapEntry pointers stay valid while entries are added.
+  std::deque<HeapEntry> entries_;
   std::deque<HeapGraphEdge> edges_;
   std::deque<HeapGraphEdge*> children_;
   std::vector<HeapEntry*> sorted_entries_;
@@ -18,27 +18,11 @@
 namespace v8 {
 namespace internal {
 
-// Number of times a function has to be seen on the stack before it is
-// optimized.
-static const int kProfilerTicksBeforeOptimization = 2;
-
-// The number of ticks required for optimizing a function increases with
-// the size of the bytecode. This is in addition to the
-// kProfilerTicksBeforeOptimization required for any function.
-static const int kBytecodeSizeAllowancePerTick = 1200;
-
 // Maximum size in bytes of generate code for a function to allow OSR.
 static const int kOSRBytecodeSizeAllowanceBase = 180;
 
 static const int kOSRBytecodeSizeAllowancePerTick = 48;
 
-// Maximum size in bytes of generated code for a function to be optimized
-// the very first time it is seen on the stack.
-static const int kMaxBytecodeSizeForEarlyOpt = 90;
-
-// Certain functions are simply too big to be worth optimizing.
-static const int kMaxBytecodeSizeForOpt = 60 * KB;
-
 #define OPTIMIZATION_REASON_LIST(V)                            \
   V(DoNotOptimize, "do not optimize")                          \
   V(HotAndStable, "hot and stable")                            \
@@ -197,30 +181,34 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction* function,
   SharedFunctionInfo* shared = function->shared();
   int ticks = function->feedback_vector()->profiler_ticks();
 
-  if (shared->bytecode_array()->length() > kMaxBytecodeSizeForOpt) {
+  if (shared->bytecode_array()->length() > FLAG_max_optimized_bytecode_size) {
     return OptimizationReason::kDoNotOptimize;
   }
 
-  int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
-      (shared->bytecode_array()->length() / kBytecodeSizeAllowancePerTick);
+  // A non-positive allowance disables the size-dependent extra ticks.
+  int ticks_for_optimization = FLAG_ticks_before_optimization;
+  if (FLAG_bytecode_size_allowance_per_tick > 0) {
+    ticks_for_optimization += shared->bytecode_array()->length() /
+                              FLAG_bytecode_size_allowance_per_tick;
+  }
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
   } else if (!any_ic_changed_ &&
-             shared->bytecode_array()->length() < kMaxBytecodeSizeForEarlyOpt) {
+             shared->bytecode_array()->length() <
+                 FLAG_max_bytecode_size_for_early_opt) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
     return OptimizationReason::kSmallFunction;
   } else if (FLAG_trace_opt_verbose) {
     PrintF("[not yet optimizing ");
     function->PrintName();
-    PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
+    PrintF(", not enough ticks: %d/%d and ", ticks, ticks_for_optimization);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
-             shared->bytecode_array()->length(), kMaxBytecodeSizeForEarlyOpt);
+             shared->bytecode_array()->length(),
+             FLAG_max_bytecode_size_for_early_opt);
     }
   }
   return OptimizationReason::kDoNotOptimize;
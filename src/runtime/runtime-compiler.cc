@@ -140,6 +140,7 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   TimerEventScope<TimerEventDeoptimizeCode> timer(isolate);
   TRACE_EVENT0("v8", "V8.DeoptimizeCode");
   Handle<JSFunction> function = deoptimizer->function();
+  Handle<Code> optimized_code = deoptimizer->compiled_code();
   Deoptimizer::BailoutType type = deoptimizer->bailout_type();
   bool preserve_optimized_code = deoptimizer->preserve_optimized();
 
@@ -156,9 +157,10 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
-  // Invalidate the underlying optimized code on non-lazy deopts.
+  // Invalidate the underlying optimized code on non-lazy deopts. This is the
+  // code we deoptimized from, which for OSR code is not the function's code.
   if (type != Deoptimizer::LAZY && !preserve_optimized_code) {
-    Deoptimizer::DeoptimizeFunction(*function);
+    Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
   }
 
   return isolate->heap()->undefined_value();
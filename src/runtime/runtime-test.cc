@@ -124,6 +124,21 @@ RUNTIME_FUNCTION(Runtime_DeoptimizeFunction) {
   }
   Handle<JSFunction> function = Handle<JSFunction>::cast(function_object);
 
+  // Code compiled for on-stack replacement of the function's loops is not
+  // installed on the function, so deoptimize it separately.
+  if (function->has_feedback_vector()) {
+    Handle<FixedArray> osr_code_cache(
+        function->feedback_vector()->osr_code_cache(), isolate);
+    for (int i = FeedbackVector::kOsrCodeCacheCodeIndex;
+         i < osr_code_cache->length();
+         i += FeedbackVector::kOsrCodeCacheEntrySize) {
+      WeakCell* cell = WeakCell::cast(osr_code_cache->get(i));
+      if (!cell->cleared()) {
+        Deoptimizer::DeoptimizeFunction(*function, Code::cast(cell->value()));
+      }
+    }
+  }
+
   // If the function is not optimized, just return.
   if (!function->IsOptimized()) return isolate->heap()->undefined_value();
 
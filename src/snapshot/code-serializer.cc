@@ -385,19 +385,26 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 }
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
-    Isolate* isolate, uint32_t expected_source_hash) const {
+    Isolate* isolate, uint32_t expected_source_hash, bool verified) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != ComputeMagicNumber(isolate)) return MAGIC_NUMBER_MISMATCH;
-  uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
   uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  if (verified) return CHECK_SUCCESS;
+  return SanityCheckWithoutIsolate();
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutIsolate() const {
+  if (this->size_ < kHeaderSize) return INVALID_HEADER;
+  uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c1 = GetHeaderValue(kChecksum1Offset);
   uint32_t c2 = GetHeaderValue(kChecksum2Offset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (cpu_features != static_cast<uint32_t>(CpuFeatures::SupportedFeatures())) {
     return CPU_FEATURES_MISMATCH;
   }
@@ -460,7 +467,8 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  *rejection_result = scd.SanityCheck(isolate, expected_source_hash,
+                                      cached_data->verified());
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -468,5 +476,18 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+SerializedCodeData::SanityCheckResult SerializedCodeData::Verify(
+    ScriptData* cached_data) {
+  DisallowHeapAllocation no_gc;
+  SerializedCodeData scd(cached_data);
+  SanityCheckResult result = scd.SanityCheckWithoutIsolate();
+  if (result == CHECK_SUCCESS) {
+    cached_data->MarkVerified();
+  } else {
+    cached_data->Reject();
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
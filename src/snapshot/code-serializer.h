@@ -122,6 +122,12 @@ class SerializedCodeData : public SerializedData {
                                            uint32_t expected_source_hash,
                                            SanityCheckResult* rejection_result);
 
+  // Performs the part of the sanity check that depends neither on the isolate
+  // nor on the source, including the O(n) payload checksum, and marks
+  // {cached_data} as either verified or rejected. Does not touch the heap and
+  // may be called on a background thread.
+  static SanityCheckResult Verify(ScriptData* cached_data);
+
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
                      const CodeSerializer* cs);
@@ -146,7 +152,9 @@ class SerializedCodeData : public SerializedData {
   }
 
   SanityCheckResult SanityCheck(Isolate* isolate,
-                                uint32_t expected_source_hash) const;
+                                uint32_t expected_source_hash,
+                                bool verified) const;
+  SanityCheckResult SanityCheckWithoutIsolate() const;
 };
 
 }  // namespace internal
@@ -98,7 +98,7 @@ void ObjectDeserializer::
 
 void ObjectDeserializer::CommitPostProcessedObjects() {
   CHECK_LE(new_internalized_strings().size(), kMaxInt);
-  StringTable::EnsureCapacityForDeserialization(
+  StringTable::EnsureCapacityForInsertions(
       isolate(), static_cast<int>(new_internalized_strings().size()));
   for (Handle<String> string : new_internalized_strings()) {
     StringTableInsertionKey key(*string);
@@ -2,7 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "src/api.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/spaces.h"
 #include "src/isolate.h"
@@ -373,6 +377,201 @@ TEST(ArrayBuffer_RetainedSizeDecreases) {
   CHECK_EQ(0, retained_after - retained_before);
 }
 
+TEST(ArrayBuffer_ExternalMemoryStatistics) {
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+
+  v8::HeapStatistics before;
+  isolate->GetHeapStatistics(&before);
+  {
+    const size_t kArraybufferSize = 117;
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kArraybufferSize);
+    USE(ab);
+    v8::HeapStatistics after;
+    isolate->GetHeapStatistics(&after);
+    CHECK_EQ(kArraybufferSize,
+             after.external_memory() - before.external_memory());
+  }
+}
+
+namespace {
+
+// Counts backing store allocations and frees, which may happen on a
+// background thread.
+class CountingAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  CountingAllocator() : allocator_(CcTest::array_buffer_allocator()) {}
+
+  void* Allocate(size_t length) override {
+    allocated_.Increment(1);
+    return allocator_->Allocate(length);
+  }
+
+  void* AllocateUninitialized(size_t length) override {
+    allocated_.Increment(1);
+    return allocator_->AllocateUninitialized(length);
+  }
+
+  void Free(void* data, size_t length) override {
+    freed_.Increment(1);
+    allocator_->Free(data, length);
+  }
+
+  int allocated() { return allocated_.Value(); }
+  int freed() { return freed_.Value(); }
+
+ private:
+  v8::ArrayBuffer::Allocator* allocator_;
+  base::AtomicNumber<int> allocated_;
+  base::AtomicNumber<int> freed_;
+};
+
+// Holds back background tasks until the test runs them, so that freeing
+// queued backing stores is observable.
+class BackgroundTaskPlatform : public TestPlatform {
+ public:
+  BackgroundTaskPlatform() {
+    // Now that it's completely constructed, make this the current platform.
+    i::V8::SetPlatformForTesting(this);
+  }
+  ~BackgroundTaskPlatform() override {
+    // Tasks that are still pending have been cancelled at isolate tear down.
+    for (v8::Task* task : tasks_) delete task;
+  }
+
+  void CallOnBackgroundThread(v8::Task* task,
+                              ExpectedRuntime expected_runtime) override {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    tasks_.push_back(task);
+  }
+
+  bool PendingBackgroundTasks() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    return !tasks_.empty();
+  }
+
+  void RunBackgroundTasks() {
+    std::vector<v8::Task*> tasks;
+    {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      tasks.swap(tasks_);
+    }
+    for (v8::Task* task : tasks) {
+      task->Run();
+      delete task;
+    }
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::vector<v8::Task*> tasks_;
+};
+
+const int kNumDeadBuffers = 10;
+const size_t kBackingStoreSize = 100;
+
+void AllocateDeadBuffers(v8::Isolate* isolate) {
+  v8::HandleScope handle_scope(isolate);
+  for (int i = 0; i < kNumDeadBuffers; i++) {
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kBackingStoreSize);
+    USE(ab);
+  }
+}
+
+void CheckDeadBackingStoresFreedAfterGC(bool concurrent_freeing,
+                                        AllocationSpace space) {
+  ManualGCScope manual_gc_scope;
+  const bool flag_concurrent_freeing = FLAG_concurrent_array_buffer_freeing;
+  FLAG_concurrent_array_buffer_freeing = concurrent_freeing;
+  BackgroundTaskPlatform platform;
+  CountingAllocator allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(v8::Context::New(isolate));
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+    Local<v8::ArrayBuffer> live =
+        v8::ArrayBuffer::New(isolate, kBackingStoreSize);
+    // Empty the new space, so that the dead buffers below are on pages that
+    // are evacuated and not promoted as a whole.
+    heap::GcAndSweep(heap, NEW_SPACE);
+    heap::GcAndSweep(heap, NEW_SPACE);
+    platform.RunBackgroundTasks();
+    const int freed_before = allocator.freed();
+
+    AllocateDeadBuffers(isolate);
+    heap::GcAndSweep(heap, space);
+    if (!concurrent_freeing) {
+      CHECK_EQ(freed_before + kNumDeadBuffers, allocator.freed());
+    } else if (space == NEW_SPACE) {
+      // The scavenger only queues the dead backing stores.
+      CHECK_EQ(freed_before, allocator.freed());
+      CHECK(platform.PendingBackgroundTasks());
+    }
+    platform.RunBackgroundTasks();
+    CHECK_EQ(freed_before + kNumDeadBuffers, allocator.freed());
+
+    // Another GC neither frees the dead backing stores again nor frees the
+    // backing store of the live buffer.
+    heap::GcAndSweep(heap, space);
+    platform.RunBackgroundTasks();
+    CHECK_EQ(freed_before + kNumDeadBuffers, allocator.freed());
+    CHECK_NOT_NULL(live->GetContents().Data());
+  }
+  isolate->Dispose();
+  CHECK_EQ(allocator.allocated(), allocator.freed());
+  FLAG_concurrent_array_buffer_freeing = flag_concurrent_freeing;
+}
+
+}  // namespace
+
+TEST(ArrayBuffer_FreedAfterScavenge) {
+  CheckDeadBackingStoresFreedAfterGC(true, NEW_SPACE);
+  CheckDeadBackingStoresFreedAfterGC(false, NEW_SPACE);
+}
+
+TEST(ArrayBuffer_FreedAfterFullGC) {
+  CheckDeadBackingStoresFreedAfterGC(true, OLD_SPACE);
+  CheckDeadBackingStoresFreedAfterGC(false, OLD_SPACE);
+}
+
+TEST(ArrayBuffer_QueuedBackingStoresFreedAtTearDown) {
+  ManualGCScope manual_gc_scope;
+  const bool flag_concurrent_freeing = FLAG_concurrent_array_buffer_freeing;
+  FLAG_concurrent_array_buffer_freeing = true;
+  BackgroundTaskPlatform platform;
+  CountingAllocator allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(v8::Context::New(isolate));
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+    heap::GcAndSweep(heap, NEW_SPACE);
+    heap::GcAndSweep(heap, NEW_SPACE);
+    platform.RunBackgroundTasks();
+    const int freed_before = allocator.freed();
+
+    AllocateDeadBuffers(isolate);
+    heap::GcAndSweep(heap, NEW_SPACE);
+    CHECK_EQ(freed_before, allocator.freed());
+    CHECK(platform.PendingBackgroundTasks());
+  }
+  // The freeing task never runs; tear down frees the queued backing stores.
+  isolate->Dispose();
+  CHECK_EQ(allocator.allocated(), allocator.freed());
+  FLAG_concurrent_array_buffer_freeing = flag_concurrent_freeing;
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
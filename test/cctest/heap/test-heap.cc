@@ -2634,6 +2634,60 @@ TEST(OptimizedPretenuringNestedDoubleLiterals) {
 }
 
 
+TEST(EagerPretenuringWithoutMaximumCapacity) {
+  FLAG_allow_natives_syntax = true;
+  FLAG_eager_pretenuring = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer() || FLAG_always_opt) return;
+  if (FLAG_gc_global || FLAG_stress_compaction ||
+      FLAG_stress_incremental_marking)
+    return;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  // Without --eager-pretenuring sites are only tenured by scavenges at
+  // maximum new space capacity.
+  if (heap->new_space()->IsAtMaximumCapacity()) return;
+  v8::HandleScope scope(CcTest::isolate());
+
+  // All literals of a call stay alive until the next call of f, so every
+  // scavenge finds all mementos created since the previous one.
+  i::ScopedVector<char> source(1024);
+  i::SNPrintF(source,
+              "var number_elements = %d;"
+              "var elements = new Array(number_elements);"
+              "function f() {"
+              "  for (var i = 0; i < number_elements; i++) {"
+              "    elements[i] = [1.1, 1.2, 1.3];"
+              "  }"
+              "  return elements[number_elements - 1];"
+              "};"
+              "f();",
+              2 * kPretenureCreationCount);
+  CompileRun(source.start());
+  Handle<AllocationSite> site =
+      handle(AllocationSite::cast(heap->allocation_sites_list()), isolate);
+  CHECK(site->PointsToLiteral());
+
+  // The first scavenge with a high survival rate only marks the site.
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(!heap->new_space()->IsAtMaximumCapacity());
+  CHECK_EQ(AllocationSite::kMaybeTenure, site->pretenure_decision());
+
+  // The second one tenures it even though new space did not grow.
+  CompileRun("f();");
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(!heap->new_space()->IsAtMaximumCapacity());
+  CHECK_EQ(AllocationSite::kTenure, site->pretenure_decision());
+  CHECK_EQ(TENURED, site->GetPretenureMode());
+
+  v8::Local<v8::Value> res =
+      CompileRun("%OptimizeFunctionOnNextCall(f); f();");
+  i::Handle<JSObject> o = Handle<JSObject>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Object>::Cast(res)));
+  CHECK(heap->InOldSpace(*o));
+  CHECK(heap->InOldSpace(o->elements()));
+}
+
 // Test regular array literals allocation.
 TEST(OptimizedAllocationArrayLiterals) {
   FLAG_allow_natives_syntax = true;
@@ -5932,6 +5986,53 @@ UNINITIALIZED_TEST(ReinitializeStringHashSeed) {
   }
 }
 
+struct OutOfMemoryState {
+  Heap* heap;
+  bool oom_triggered;
+  size_t current_heap_limit;
+  size_t initial_heap_limit;
+};
+
+size_t NearHeapLimitCallback(void* raw_state, size_t current_heap_limit,
+                             size_t initial_heap_limit) {
+  OutOfMemoryState* state = static_cast<OutOfMemoryState*>(raw_state);
+  state->oom_triggered = true;
+  state->current_heap_limit = current_heap_limit;
+  state->initial_heap_limit = initial_heap_limit;
+  return initial_heap_limit + 100 * MB;
+}
+
+UNINITIALIZED_TEST(OutOfMemoryNearHeapLimitCallback) {
+  if (FLAG_stress_incremental_marking) return;
+  v8::Isolate::CreateParams create_params;
+  create_params.constraints.set_max_old_space_size(20);
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  OutOfMemoryState state;
+  state.heap = heap;
+  state.oom_triggered = false;
+  isolate->AddNearHeapLimitCallback(NearHeapLimitCallback, &state);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    HandleScope handle_scope(i_isolate);
+    const int kMaxObjects = 1000;
+    const int kFixedArrayLen = 8 * KB;
+    for (int i = 0; i < kMaxObjects && !state.oom_triggered; i++) {
+      i_isolate->factory()->NewFixedArray(kFixedArrayLen, TENURED);
+    }
+    CHECK(state.oom_triggered);
+    CHECK_EQ(state.initial_heap_limit, state.current_heap_limit);
+    CHECK_EQ(state.initial_heap_limit + 100 * MB,
+             heap->MaxOldGenerationSize());
+  }
+  isolate->RemoveNearHeapLimitCallback(NearHeapLimitCallback,
+                                       state.initial_heap_limit);
+  CHECK_GT(state.initial_heap_limit + 100 * MB, heap->MaxOldGenerationSize());
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
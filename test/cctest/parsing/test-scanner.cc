@@ -5,6 +5,7 @@
 // Tests v8::internal::Scanner. Note that presently most unit tests for the
 // Scanner are in cctest/test-parsing.cc, rather than here.
 
+#include "src/ast/ast-value-factory.h"
 #include "src/handles-inl.h"
 #include "src/objects-inl.h"
 #include "src/parsing/scanner-character-streams.h"
@@ -48,6 +49,59 @@ ScannerTestHelper make_scanner(const char* src) {
   return helper;
 }
 
+// Streams |source| in chunks of at most |chunk_size| bytes, so that the
+// scanner runs out of buffered characters in the middle of tokens, comments
+// and whitespace.
+class ChunkedSource : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  ChunkedSource(const std::string& source, size_t chunk_size)
+      : source_(source), chunk_size_(chunk_size), position_(0) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    size_t length = std::min(chunk_size_, source_.length() - position_);
+    uint8_t* chunk = new uint8_t[length];
+    i::MemCopy(chunk, source_.data() + position_, length);
+    position_ += length;
+    *src = chunk;
+    return length;
+  }
+
+ private:
+  std::string source_;
+  size_t chunk_size_;
+  size_t position_;
+};
+
+struct ScannedToken {
+  Token::Value token;
+  int beg_pos;
+  int end_pos;
+  const AstRawString* literal;
+};
+
+std::vector<ScannedToken> ScanChunked(
+    const std::string& source, size_t chunk_size,
+    v8::ScriptCompiler::StreamedSource::Encoding encoding,
+    AstValueFactory* ast_value_factory) {
+  ChunkedSource chunked_source(source, chunk_size);
+  std::unique_ptr<Utf16CharacterStream> stream(
+      ScannerStream::For(&chunked_source, encoding, nullptr));
+  int use_counts[v8::Isolate::kUseCounterFeatureCount] = {};
+  Scanner scanner(CcTest::i_isolate()->unicode_cache(), use_counts);
+  scanner.Initialize(stream.get(), false);
+  std::vector<ScannedToken> tokens;
+  do {
+    Token::Value token = scanner.Next();
+    const AstRawString* literal =
+        token == Token::IDENTIFIER || token == Token::STRING
+            ? scanner.CurrentSymbol(ast_value_factory)
+            : nullptr;
+    tokens.push_back({token, scanner.location().beg_pos,
+                      scanner.location().end_pos, literal});
+  } while (tokens.back().token != Token::EOS);
+  return tokens;
+}
+
 }  // anonymous namespace
 
 // CHECK_TOK checks token equality, but by checking for equality of the token
@@ -135,5 +189,63 @@ TEST(ContextualKeywordTokens) {
   CHECK_TOK(Token::UNINITIALIZED, scanner->current_contextual_token());
 }
 
+TEST(RunsAcrossChunkBoundaries) {
+  CcTest::InitializeVM();
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(
+      &zone, CcTest::i_isolate()->ast_string_constants(),
+      CcTest::i_isolate()->heap()->HashSeed());
+
+  // Sources in UTF-8. The scanner skips the comments and whitespace and
+  // collects identifiers and plain string bodies in bulk; every chunk size
+  // puts a chunk boundary at a different point inside these runs.
+  const std::string kLongComment = "/*" + std::string(1500, 'c') + "*/ x";
+  const std::string kLongIdentifier = std::string(1500, 'i') + " x";
+  const std::string test_cases[] = {
+      "a // a single line comment\n b",
+      "a /* a multi-line comment\n with ** stars */ b /**/ c",
+      "a          \t\t      b\n          c",
+      "someVeryLongIdentifierName_with$Mixed123 anotherIdentifier _",
+      "'a plain string body' \"and another one\" 'escaped\\'quote'",
+      kLongComment,
+      kLongIdentifier,
+      // Lead surrogates (U+1F4A9, U+10400) stopping the runs.
+      "'ab\xf0\x9f\x92\xa9" "cd' x",
+      "abc\xf0\x90\x90\x80" "def x",
+      "x   \xf0\x90\x90\x80y",
+      "// \xf0\x9f\x92\xa9\nx",
+      "/* \xf0\x9f\x92\xa9 */ x",
+  };
+
+  for (const std::string& source : test_cases) {
+    std::vector<ScannedToken> expected =
+        ScanChunked(source, source.length(),
+                    v8::ScriptCompiler::StreamedSource::UTF8,
+                    &ast_value_factory);
+    bool is_ascii = std::all_of(source.begin(), source.end(),
+                                [](char c) { return (c & 0x80) == 0; });
+    for (size_t chunk_size = 1; chunk_size <= source.length(); chunk_size++) {
+      // Long sources are checked with a sample of chunk sizes.
+      if (chunk_size > 64 && chunk_size % 97 != 0) continue;
+      for (auto encoding : {v8::ScriptCompiler::StreamedSource::UTF8,
+                            v8::ScriptCompiler::StreamedSource::ONE_BYTE}) {
+        if (encoding == v8::ScriptCompiler::StreamedSource::ONE_BYTE &&
+            !is_ascii) {
+          continue;
+        }
+        std::vector<ScannedToken> tokens =
+            ScanChunked(source, chunk_size, encoding, &ast_value_factory);
+        CHECK_EQ(expected.size(), tokens.size());
+        for (size_t i = 0; i < tokens.size(); i++) {
+          CHECK_TOK(expected[i].token, tokens[i].token);
+          CHECK_EQ(expected[i].beg_pos, tokens[i].beg_pos);
+          CHECK_EQ(expected[i].end_pos, tokens[i].end_pos);
+          CHECK_EQ(expected[i].literal, tokens[i].literal);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -43,6 +43,7 @@
 #include "src/base/platform/platform.h"
 #include "src/code-stubs.h"
 #include "src/compilation-cache.h"
+#include "src/compiler.h"
 #include "src/debug/debug.h"
 #include "src/execution.h"
 #include "src/futex-emulation.h"
@@ -50,6 +51,8 @@
 #include "src/heap/local-allocator.h"
 #include "src/lookup.h"
 #include "src/objects-inl.h"
+#include "src/parsing/background-parsing-task.h"
+#include "src/parsing/parser.h"
 #include "src/parsing/preparse-data.h"
 #include "src/profiler/cpu-profiler.h"
 #include "src/unicode-inl.h"
@@ -25098,6 +25101,112 @@ TEST(StreamingBiggerScript) {
 }
 
 
+TEST(StreamingWithBackgroundCompile) {
+  bool old_flag = i::FLAG_background_compile;
+  i::FLAG_background_compile = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Top-level code, an eagerly compiled IIFE and a lazy function.
+  const char* chunks[] = {"var x = (function() { return 6; })();",
+                          "function lazy(y) { return x + y; }",
+                          "lazy(7);", nullptr};
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  task->Run();
+  delete task;
+
+  // The bytecode was generated by the task, and the IIFE got its own job.
+  i::StreamedSource* impl = source.impl();
+  CHECK(impl->outer_function_job);
+  CHECK(!impl->inner_function_jobs.empty());
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+
+  // Errors still surface on the main thread.
+  const char* error_chunks[] = {"var if else then foo", nullptr};
+  RunStreamingTest(error_chunks, v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                   false);
+
+  i::FLAG_background_compile = old_flag;
+}
+
+
+namespace {
+
+class StreamingTaskThread : public v8::base::Thread {
+ public:
+  explicit StreamingTaskThread(v8::ScriptCompiler::ScriptStreamingTask* task)
+      : Thread(Options("StreamingTaskThread")), task_(task) {}
+
+  void Run() override { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ScriptStreamingTask* task_;
+};
+
+}  // namespace
+
+TEST(StreamingWithBackgroundCompileAndRuntimeStats) {
+  bool old_background_compile = i::FLAG_background_compile;
+  int old_runtime_stats = i::FLAG_runtime_stats;
+  i::FLAG_background_compile = true;
+  i::FLAG_runtime_stats = 1;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  v8::HandleScope scope(isolate);
+
+  const char* chunks[] = {"var x = (function() { return 6; })();",
+                          "function lazy(y) { return x + y; }",
+                          "lazy(7);", nullptr};
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  // Bytecode generation on the streaming thread must not touch the main
+  // thread's RuntimeCallStats; its time is reported as background time.
+  StreamingTaskThread thread(task);
+  thread.Start();
+  thread.Join();
+  delete task;
+  CHECK(source.impl()->outer_function_job);
+
+  i::RuntimeCallStats* stats = i_isolate->counters()->runtime_call_stats();
+  int64_t background_count = stats->CompileBackgroundIgnition.count();
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  CHECK_LT(background_count, stats->CompileBackgroundIgnition.count());
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+
+  i::FLAG_runtime_stats = old_runtime_stats;
+  i::FLAG_background_compile = old_background_compile;
+}
+
+
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
   {
@@ -25501,6 +25610,106 @@ TEST(CodeCache) {
 }
 
 
+TEST(StreamingConsumesCodeCache) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  const char* chunks[] = {"function foo() { ret", "urn 13; } f", "oo(); ",
+                          nullptr};
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope cscope(context);
+    v8::ScriptCompiler::Source source(v8_str(full_source));
+    v8::ScriptCompiler::Compile(context, &source,
+                                v8::ScriptCompiler::kProduceCodeCache)
+        .ToLocalChecked();
+    int length = source.GetCachedData()->length;
+    uint8_t* cache_data = new uint8_t[length];
+    memcpy(cache_data, source.GetCachedData()->data, length);
+    cache = new v8::ScriptCompiler::CachedData(
+        cache_data, length, v8::ScriptCompiler::CachedData::BufferOwned);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope cscope(context);
+    v8::ScriptCompiler::StreamedSource source(
+        new TestSourceStream(chunks),
+        v8::ScriptCompiler::StreamedSource::ONE_BYTE, cache);
+    v8::ScriptCompiler::ScriptStreamingTask* task =
+        v8::ScriptCompiler::StartStreamingScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache);
+    task->Run();
+    delete task;
+    CHECK(!source.GetCachedData()->rejected);
+
+    v8::ScriptOrigin origin(v8_str("http://foo.com"));
+    v8::Local<v8::Script> script;
+    {
+      i::DisallowCompilation no_compile(
+          reinterpret_cast<i::Isolate*>(isolate2));
+      script = v8::ScriptCompiler::Compile(context, &source,
+                                           v8_str(full_source), origin)
+                   .ToLocalChecked();
+    }
+    CHECK(!source.GetCachedData()->rejected);
+    CHECK_EQ(13, script->Run(context)
+                     .ToLocalChecked()
+                     ->Int32Value(context)
+                     .FromJust());
+  }
+  isolate2->Dispose();
+  delete[] full_source;
+}
+
+
+TEST(StreamingRejectsInvalidCodeCache) {
+  const char* chunks[] = {"function foo() { ret", "urn 13; } f", "oo(); ",
+                          nullptr};
+  const char* garbage = "garbage garbage garbage garbage garbage garbage";
+  v8::ScriptCompiler::CachedData* cached_data =
+      new v8::ScriptCompiler::CachedData(
+          reinterpret_cast<const uint8_t*>(garbage), 16);
+
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE, cached_data);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(
+          isolate, &source, v8::ScriptCompiler::kConsumeCodeCache);
+  task->Run();
+  delete task;
+  // The script was parsed on the background thread instead.
+  CHECK(source.GetCachedData()->rejected);
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+}
+
+
 void TestInvalidCacheData(v8::ScriptCompiler::CompileOptions option) {
   const char* garbage = "garbage garbage garbage garbage garbage garbage";
   const uint8_t* data = reinterpret_cast<const uint8_t*>(garbage);
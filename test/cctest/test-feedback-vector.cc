@@ -631,6 +631,88 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(OsrCodeCache) {
+  if (!i::FLAG_use_osr || !i::FLAG_opt || i::FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  // OSR code specialized to a single closure's context is not cached, so
+  // create a second closure for each function.
+  CompileRun(
+      "function make() {"
+      "  return function(n) {"
+      "    var result = 0;"
+      "    for (var i = 0; i < n; i++) {"
+      "      %OptimizeOsr();"
+      "      result += i;"
+      "    }"
+      "    return result;"
+      "  };"
+      "}"
+      "var sum = make(); make();"
+      "function makeTwoLoops() {"
+      "  return function(n) {"
+      "    var a = 0;"
+      "    for (var i = 0; i < n; i++) {"
+      "      %OptimizeOsr();"
+      "      a += i;"
+      "    }"
+      "    var b = 0;"
+      "    for (var j = 0; j < n; j++) {"
+      "      %OptimizeOsr();"
+      "      b -= j;"
+      "    }"
+      "    return a + b;"
+      "  };"
+      "}"
+      "var twoLoops = makeTwoLoops(); makeTwoLoops();");
+
+  // The first OSR adds an entry for the loop.
+  CompileRun("sum(10);");
+  Handle<JSFunction> sum = GetFunction("sum");
+  Handle<FeedbackVector> vector(sum->feedback_vector(), isolate);
+  CHECK_EQ(FeedbackVector::kOsrCodeCacheEntrySize,
+           vector->osr_code_cache()->length());
+  BailoutId osr_offset(Smi::ToInt(vector->osr_code_cache()->get(
+      FeedbackVector::kOsrCodeCacheOffsetIndex)));
+  Code* osr_code = vector->GetOsrCode(osr_offset);
+  CHECK_NOT_NULL(osr_code);
+  Handle<Code> first_code(osr_code, isolate);
+  CHECK_EQ(Code::OPTIMIZED_FUNCTION, first_code->kind());
+
+  // Re-entering the loop reuses the cached code.
+  CompileRun("sum(10);");
+  CHECK_EQ(FeedbackVector::kOsrCodeCacheEntrySize,
+           vector->osr_code_cache()->length());
+  CHECK_EQ(*first_code, vector->GetOsrCode(osr_offset));
+
+  // Deoptimized code is no longer handed out.
+  CompileRun("%DeoptimizeFunction(sum);");
+  CHECK(first_code->marked_for_deoptimization());
+  CHECK_NULL(vector->GetOsrCode(osr_offset));
+
+  // Each loop gets its own entry.
+  CompileRun("twoLoops(10);");
+  Handle<JSFunction> two_loops = GetFunction("twoLoops");
+  Handle<FeedbackVector> two_loops_vector(two_loops->feedback_vector(),
+                                          isolate);
+  Handle<FixedArray> cache(two_loops_vector->osr_code_cache(), isolate);
+  CHECK_EQ(2 * FeedbackVector::kOsrCodeCacheEntrySize, cache->length());
+  BailoutId first_offset(
+      Smi::ToInt(cache->get(FeedbackVector::kOsrCodeCacheOffsetIndex)));
+  BailoutId second_offset(
+      Smi::ToInt(cache->get(FeedbackVector::kOsrCodeCacheEntrySize +
+                            FeedbackVector::kOsrCodeCacheOffsetIndex)));
+  CHECK_NE(first_offset, second_offset);
+  Code* first_loop_code = two_loops_vector->GetOsrCode(first_offset);
+  Code* second_loop_code = two_loops_vector->GetOsrCode(second_offset);
+  CHECK_NOT_NULL(first_loop_code);
+  CHECK_NOT_NULL(second_loop_code);
+  CHECK_NE(first_loop_code, second_loop_code);
+}
+
 }  // namespace
 
 }  // namespace internal
@@ -185,5 +185,33 @@ TEST(PhatomHandlesWithoutCallbacks) {
   CHECK_EQ(0u, isolate->NumberOfPhantomHandleResetsSinceLastCall());
 }
 
+TEST(ScavengeManyStrongGlobalHandles) {
+  // Spans several batches of global handles that are scavenged in parallel.
+  const int kNumberOfHandles = 2500;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  std::vector<v8::Global<v8::Object>> globals(kNumberOfHandles);
+  for (int i = 0; i < kNumberOfHandles; i++) {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Object> o = v8::Object::New(isolate);
+    o->Set(context, v8_str("value"), v8::Integer::New(isolate, i)).FromJust();
+    globals[i].Reset(isolate, o);
+  }
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  for (int i = 0; i < kNumberOfHandles; i++) {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Object> o = v8::Local<v8::Object>::New(isolate, globals[i]);
+    CHECK_EQ(i, o->Get(context, v8_str("value"))
+                    .ToLocalChecked()
+                    ->Int32Value(context)
+                    .FromJust());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
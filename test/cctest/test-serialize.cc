@@ -1953,6 +1953,94 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerAfterExecute) {
+  // We test that no compilations happen when running this code. Forcing
+  // to always optimize breaks this test.
+  bool prev_always_opt_value = FLAG_always_opt;
+  FLAG_always_opt = false;
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(source_str, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &script_source, v8::ScriptCompiler::kNoCompileOptions)
+            .ToLocalChecked();
+    // Running the script lazily compiles f.
+    script->BindToCurrentContext()
+        ->Run(isolate1->GetCurrentContext())
+        .ToLocalChecked();
+
+    v8::ScriptCompiler::CachedData* data =
+        v8::ScriptCompiler::CreateCodeCache(script, source_str);
+    CHECK_NOT_NULL(data);
+    // Persist cached data.
+    uint8_t* buffer = NewArray<uint8_t>(data->length);
+    MemCopy(buffer, data->data, data->length);
+    cache = new v8::ScriptCompiler::CachedData(
+        buffer, data->length, v8::ScriptCompiler::CachedData::BufferOwned);
+    delete data;
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &script_source,
+                   v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    CheckDeserializedFlag(script);
+
+    // The lazily compiled inner function is part of the cache.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    Handle<Script> i_script(Script::cast(sfi->script()));
+    int compiled_count = 0;
+    SharedFunctionInfo::ScriptIterator iterator(i_script);
+    while (SharedFunctionInfo* next = iterator.Next()) {
+      if (next->is_compiled()) compiled_count++;
+    }
+    CHECK_EQ(2, compiled_count);
+
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                        ->Run(isolate2->GetCurrentContext())
+                                        .ToLocalChecked();
+      CHECK(result->ToString(isolate2->GetCurrentContext())
+                .ToLocalChecked()
+                ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+                .FromJust());
+    }
+  }
+  isolate2->Dispose();
+  delete cache;
+  FLAG_always_opt = prev_always_opt_value;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
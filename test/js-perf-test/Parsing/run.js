@@ -6,6 +6,7 @@
 load('../base.js');
 
 load('comments.js');
+load('scanner.js');
 
 var success = true;
 
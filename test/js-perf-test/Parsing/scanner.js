@@ -0,0 +1,54 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Uses the |code| and |iterations| globals and the Run function defined in
+// comments.js, which run.js loads first.
+//
+// The code is wrapped in a function declaration, which is only preparsed, so
+// that the benchmarks measure scanning rather than bytecode generation.
+
+new BenchmarkSuite('Identifiers', [1000], [
+  new Benchmark('Identifiers', false, true, iterations, Run, IdentifiersSetup)
+]);
+
+new BenchmarkSuite('Strings', [1000], [
+  new Benchmark('Strings', false, true, iterations, Run, StringsSetup)
+]);
+
+new BenchmarkSuite('Indentation', [1000], [
+  new Benchmark('Indentation', false, true, iterations, Run, IndentationSetup)
+]);
+
+new BenchmarkSuite('MinifiedCode', [1000], [
+  new Benchmark('MinifiedCode', false, true, iterations, Run,
+                MinifiedCodeSetup)
+]);
+
+function WrapInFunction(body) {
+  code = "function lazy() {" + body + "}";
+  %FlattenString(code);
+}
+
+function IdentifiersSetup() {
+  WrapInFunction(
+      "someLongIdentifierName = anotherIdentifier$Name + yet_another_one;"
+          .repeat(600));
+}
+
+function StringsSetup() {
+  WrapInFunction(
+      "s = 'A plain string literal without any escape sequences';"
+          .repeat(600));
+}
+
+function IndentationSetup() {
+  WrapInFunction("\n            x = y;".repeat(600));
+}
+
+function MinifiedCodeSetup() {
+  WrapInFunction(
+      ("var a=document.getElementById(\"container\"),b=a.children.length;" +
+       "for(var c=0;c<b;c++){a.children[c].className=\"item item-\"+c}")
+          .repeat(300));
+}
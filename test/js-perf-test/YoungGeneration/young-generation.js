@@ -0,0 +1,77 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// These micro-benchmarks stress the young generation garbage collector. They
+// are run once with the default Scavenger and once with --minor-mc (see
+// JSTests.json) to compare throughput of the two collectors. Pause times can
+// be compared by running the same files with --trace-gc-nvp.
+
+const iterations = 10;
+
+new BenchmarkSuite('ShortLived', [1000], [
+  new Benchmark('ShortLived', false, false, iterations, ShortLived)
+]);
+
+new BenchmarkSuite('MediumLived', [1000], [
+  new Benchmark('MediumLived', false, false, iterations, MediumLived,
+                MediumLivedSetup, MediumLivedTearDown)
+]);
+
+new BenchmarkSuite('LongLivedArrays', [1000], [
+  new Benchmark('LongLivedArrays', false, false, iterations, LongLivedArrays,
+                LongLivedArraysSetup, LongLivedArraysTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Almost everything dies before the next young generation GC. This mostly
+// measures the cost of processing roots and the old-to-new remembered set.
+function ShortLived() {
+  let result = 0;
+  for (let i = 0; i < 200000; i++) {
+    const o = {a: i, b: i + 1, c: [i, i]};
+    result += o.c.length;
+  }
+  return result;
+}
+
+// A sliding window of objects survives one or two young generation GCs before
+// it dies, as is typical for per-request state in server applications.
+const kWindowSize = 20000;
+let window;
+
+function MediumLivedSetup() {
+  window = new Array(kWindowSize);
+}
+
+function MediumLived() {
+  for (let i = 0; i < 200000; i++) {
+    window[i % kWindowSize] = {id: i, payload: [i, i + 1, i + 2]};
+  }
+}
+
+function MediumLivedTearDown() {
+  window = undefined;
+}
+
+// Most objects survive, so new space pages are densely filled with live
+// objects and are candidates for page promotion.
+let arrays;
+
+function LongLivedArraysSetup() {
+  arrays = [];
+}
+
+function LongLivedArrays() {
+  for (let i = 0; i < 2000; i++) {
+    const array = new Array(64);
+    for (let j = 0; j < array.length; j++) array[j] = {value: j};
+    arrays.push(array);
+  }
+  if (arrays.length > 20000) arrays = [];
+}
+
+function LongLivedArraysTearDown() {
+  arrays = undefined;
+}
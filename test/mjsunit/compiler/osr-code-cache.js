@@ -0,0 +1,45 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --opt
+
+// Re-entering a loop reuses the cached OSR code for that loop, and code that
+// deoptimized is not reused.
+function sum(n, x) {
+  var result = 0;
+  for (var i = 0; i < n; i++) {
+    %OptimizeOsr();
+    result += x;
+  }
+  return result;
+}
+
+for (var i = 0; i < 5; i++) {
+  assertEquals(30, sum(10, 3));
+}
+// Deoptimize the cached OSR code with a new input type.
+assertEquals("aaa", sum(3, "a"));
+for (var i = 0; i < 5; i++) {
+  assertEquals(30, sum(10, 3));
+  assertEquals("bb", sum(2, "b"));
+}
+
+// Two loops in the same function get separate cache entries.
+function twoLoops(n) {
+  var a = 0;
+  for (var i = 0; i < n; i++) {
+    %OptimizeOsr();
+    a += i;
+  }
+  var b = 0;
+  for (var j = 0; j < n; j++) {
+    %OptimizeOsr();
+    b -= j;
+  }
+  return a + b;
+}
+
+for (var i = 0; i < 5; i++) {
+  assertEquals(0, twoLoops(10));
+}
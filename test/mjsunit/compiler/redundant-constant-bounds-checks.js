@@ -0,0 +1,40 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// The bounds check for a[3] covers the accesses to a[0] through a[2].
+(function() {
+  function sum(a) { return a[3] + a[0] + a[1] + a[2]; }
+
+  var a = new Float64Array([1, 2, 3, 4]);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertOptimized(sum);
+  // Shorter arrays must still fail the (dominating) bounds check.
+  assertEquals(NaN, sum(new Float64Array([1, 2, 3])));
+  assertEquals(10, sum(a));
+})();
+
+// A check before a loop covers constant index accesses inside the loop.
+(function() {
+  function scale(a, n) {
+    var x = a[1];
+    var result = 0;
+    for (var i = 0; i < n; ++i) {
+      result += a[0] * x + a[1];
+    }
+    return result;
+  }
+
+  var a = new Float64Array([2, 3]);
+  assertEquals(18, scale(a, 2));
+  assertEquals(18, scale(a, 2));
+  %OptimizeFunctionOnNextCall(scale);
+  assertEquals(18, scale(a, 2));
+  assertOptimized(scale);
+  assertEquals(NaN, scale(new Float64Array([2]), 2));
+})();
@@ -0,0 +1,66 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// TypedArray.prototype.set between typed arrays of different element types
+// converts each element directly between the backing stores. Check every
+// source/destination pair against element-wise assignment, with a nonzero
+// offset so that the elements around the copied range must stay untouched.
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  Float32Array,
+  Float64Array
+];
+
+var values = [
+  0, -0, 1, -1, 127, 128, 255, 256, -128, -129, 32767, 32768, 65535, 65536,
+  2147483647, 2147483648, -2147483648, -2147483649, 4294967295, 4294967296,
+  0.5, 1.5, 2.5, -0.5, -1.5, 254.5, 255.5, 1e40, -1e40, 1e-40,
+  NaN, Infinity, -Infinity
+];
+
+var kOffset = 3;
+var kPadding = 2;
+var kSentinel = 7;
+
+typedArrayConstructors.forEach(function(sourceConstructor) {
+  var source = new sourceConstructor(values);
+  typedArrayConstructors.forEach(function(destConstructor) {
+    var length = kOffset + source.length + kPadding;
+    var expected = new destConstructor(length);
+    var dest = new destConstructor(length);
+    expected.fill(kSentinel);
+    dest.fill(kSentinel);
+    for (var i = 0; i < source.length; i++) {
+      expected[kOffset + i] = source[i];
+    }
+
+    dest.set(source, kOffset);
+
+    var name = sourceConstructor.name + " -> " + destConstructor.name;
+    for (var i = 0; i < length; i++) {
+      assertEquals(expected[i], dest[i], name + " at " + i);
+    }
+  });
+});
+
+// The copy must not write past the end of the destination, and an offset
+// that does not leave room for the source throws before anything is copied.
+typedArrayConstructors.forEach(function(sourceConstructor) {
+  var source = new sourceConstructor(values);
+  typedArrayConstructors.forEach(function(destConstructor) {
+    var dest = new destConstructor(kOffset + source.length);
+    dest.fill(kSentinel);
+    assertThrows(function() { dest.set(source, kOffset + 1); }, RangeError);
+    for (var i = 0; i < dest.length; i++) {
+      assertEquals(kSentinel, dest[i]);
+    }
+  });
+});
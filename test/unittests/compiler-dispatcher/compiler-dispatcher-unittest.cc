@@ -976,6 +976,44 @@ TEST_F(CompilerDispatcherTest, CompileLazy2FinishesDispatcherJob) {
   ASSERT_FALSE(dispatcher->IsEnqueued(shared2));
 }
 
+TEST_F(CompilerDispatcherTest, SpeculativeCompileOfCalledFunctions) {
+  CompilerDispatcher* dispatcher = i_isolate()->compiler_dispatcher();
+  FLAG_speculative_compile_max_functions = 8;
+
+  // Both functions are called from top-level code, but spec_a only on a path
+  // that is not taken, so its job is still pending when the script is done.
+  const char source[] =
+      "function spec_a() { return 1; }"
+      "function spec_b() { return 2; }"
+      "function spec_c() { return 3; }"
+      "if (false) spec_a();"
+      "spec_b();"
+      "spec_a;";
+  Handle<JSFunction> a =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), source));
+  Handle<SharedFunctionInfo> shared_a(a->shared(), i_isolate());
+  Handle<JSFunction> b =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), "spec_b;"));
+  Handle<SharedFunctionInfo> shared_b(b->shared(), i_isolate());
+  Handle<JSFunction> c =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), "spec_c;"));
+  Handle<SharedFunctionInfo> shared_c(c->shared(), i_isolate());
+  FLAG_speculative_compile_max_functions = 0;
+
+  ASSERT_FALSE(shared_a->is_compiled());
+  ASSERT_TRUE(dispatcher->IsEnqueued(shared_a));
+  // spec_b was finished by its first call.
+  ASSERT_TRUE(shared_b->is_compiled());
+  ASSERT_FALSE(dispatcher->IsEnqueued(shared_b));
+  // spec_c is never called.
+  ASSERT_FALSE(shared_c->is_compiled());
+  ASSERT_FALSE(dispatcher->IsEnqueued(shared_c));
+
+  test::RunJS(isolate(), "spec_a();");
+  ASSERT_TRUE(shared_a->is_compiled());
+  ASSERT_FALSE(dispatcher->IsEnqueued(shared_a));
+}
+
 TEST_F(CompilerDispatcherTest, EnqueueAndStepTwice) {
   MockPlatform platform;
   CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
@@ -0,0 +1,107 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/redundancy-elimination.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-reducer-unittest.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+using testing::_;
+using testing::StrictMock;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class RedundancyEliminationTest : public TypedGraphTest {
+ public:
+  RedundancyEliminationTest() : TypedGraphTest(4), simplified_(zone()) {}
+  ~RedundancyEliminationTest() override {}
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+// -----------------------------------------------------------------------------
+// CheckBounds
+
+TEST_F(RedundancyEliminationTest, CheckBoundsSubsumedByLargerIndex) {
+  Node* length = Parameter(Type::Unsigned31(), 0);
+  Node* index1 = Parameter(Type::Range(3.0, 5.0, zone()), 1);
+  Node* index2 = Parameter(Type::Range(0.0, 3.0, zone()), 2);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  RedundancyElimination reducer(&editor, zone());
+
+  reducer.Reduce(graph()->start());
+
+  Node* check1 = effect = graph()->NewNode(simplified()->CheckBounds(), index1,
+                                           length, effect, control);
+  ASSERT_TRUE(reducer.Reduce(check1).Changed());
+
+  Node* check2 = graph()->NewNode(simplified()->CheckBounds(), index2, length,
+                                  effect, control);
+  EXPECT_CALL(editor, ReplaceWithValue(check2, index2, _, _));
+  Reduction r = reducer.Reduce(check2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(index2, r.replacement());
+}
+
+TEST_F(RedundancyEliminationTest, CheckBoundsWithDifferentLengthIsKept) {
+  Node* length1 = Parameter(Type::Unsigned31(), 0);
+  Node* length2 = Parameter(Type::Unsigned31(), 1);
+  Node* index1 = Parameter(Type::Range(3.0, 5.0, zone()), 2);
+  Node* index2 = Parameter(Type::Range(0.0, 3.0, zone()), 3);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  RedundancyElimination reducer(&editor, zone());
+
+  reducer.Reduce(graph()->start());
+
+  Node* check1 = effect = graph()->NewNode(simplified()->CheckBounds(), index1,
+                                           length1, effect, control);
+  ASSERT_TRUE(reducer.Reduce(check1).Changed());
+
+  Node* check2 = graph()->NewNode(simplified()->CheckBounds(), index2,
+                                  length2, effect, control);
+  Reduction r = reducer.Reduce(check2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(check2, r.replacement());
+}
+
+TEST_F(RedundancyEliminationTest, CheckBoundsWithIndexPastMinimumIsKept) {
+  Node* length = Parameter(Type::Unsigned31(), 0);
+  Node* index1 = Parameter(Type::Range(3.0, 5.0, zone()), 1);
+  Node* index2 = Parameter(Type::Range(0.0, 4.0, zone()), 2);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  StrictMock<MockAdvancedReducerEditor> editor;
+  RedundancyElimination reducer(&editor, zone());
+
+  reducer.Reduce(graph()->start());
+
+  Node* check1 = effect = graph()->NewNode(simplified()->CheckBounds(), index1,
+                                           length, effect, control);
+  ASSERT_TRUE(reducer.Reduce(check1).Changed());
+
+  Node* check2 = graph()->NewNode(simplified()->CheckBounds(), index2, length,
+                                  effect, control);
+  Reduction r = reducer.Reduce(check2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(check2, r.replacement());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
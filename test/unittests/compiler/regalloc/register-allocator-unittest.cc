@@ -343,6 +343,25 @@ TEST_F(RegisterAllocatorTest, MoveLotsOfConstants) {
   Allocate();
 }
 
+TEST_F(RegisterAllocatorTest, ManyOverlappingLiveRanges) {
+  // Far more simultaneously live values than registers, used in reverse
+  // definition order, so that most ranges are split and re-queued as
+  // unhandled while allocation is in progress.
+  const int kValues = kDefaultNRegs * 16;
+
+  StartBlock();
+  VReg values[kValues];
+  for (int i = 0; i < kValues; ++i) {
+    values[i] = Define(Reg());
+  }
+  for (int i = kValues - 1; i >= 0; --i) {
+    EmitI(Reg(values[i]));
+  }
+  EndBlock(Last());
+
+  Allocate();
+}
+
 TEST_F(RegisterAllocatorTest, SplitBeforeInstruction) {
   const int kNumRegs = 6;
   SetNumRegs(kNumRegs, kNumRegs);
@@ -48,6 +48,18 @@ TEST(Heap, HeapGrowingFactor) {
                     Heap::HeapGrowingFactor(400, 1, 4.0));
 }
 
+TEST(Heap, HeapGrowingFactorWithTargetMutatorUtilization) {
+  CheckEqualRounded(Heap::HeapGrowingFactor(100, 1, 4.0),
+                    Heap::HeapGrowingFactor(100, 1, 4.0,
+                                            Heap::kTargetMutatorUtilization));
+  CheckEqualRounded(1.235, Heap::HeapGrowingFactor(100, 1, 4.0, 0.95));
+  CheckEqualRounded(Heap::kMaxHeapGrowingFactor,
+                    Heap::HeapGrowingFactor(100, 1, 4.0, 0.99));
+  // A lower target mutator utilization results in a smaller heap.
+  EXPECT_LT(Heap::HeapGrowingFactor(50, 1, 4.0, 0.9),
+            Heap::HeapGrowingFactor(50, 1, 4.0, 0.97));
+}
+
 TEST(Heap, MaxHeapGrowingFactor) {
   CheckEqualRounded(
       1.3, Heap::MaxHeapGrowingFactor(Heap::kMinOldGenerationSize * MB));
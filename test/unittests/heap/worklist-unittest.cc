@@ -4,6 +4,11 @@
 
 #include "src/heap/worklist.h"
 
+#include <string>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/platform.h"
+#include "src/heap/barrier.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -301,6 +306,56 @@ TEST(WorkListTest, MultipleSegmentsStolen) {
   EXPECT_TRUE(worklist.IsGlobalEmpty());
 }
 
+TEST(WorkListTest, OwnPoolIsPreferred) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy1;
+  SomeObject dummy2;
+  for (size_t i = 0; i < TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy1));
+    EXPECT_TRUE(worklist_view2.Push(&dummy2));
+  }
+  worklist.FlushToGlobal(0);
+  worklist.FlushToGlobal(1);
+  EXPECT_TRUE(worklist_view1.IsLocalEmpty());
+  EXPECT_TRUE(worklist_view2.IsLocalEmpty());
+  SomeObject* retrieved = nullptr;
+  for (size_t i = 0; i < TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+    EXPECT_EQ(&dummy2, retrieved);
+  }
+  for (size_t i = 0; i < TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Pop(&retrieved));
+    EXPECT_EQ(&dummy1, retrieved);
+  }
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
+TEST(WorkListTest, StealFromAllPools) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  TestWorklist::View worklist_view3(&worklist, 2);
+  SomeObject dummy1;
+  SomeObject dummy2;
+  EXPECT_TRUE(worklist_view1.Push(&dummy1));
+  EXPECT_TRUE(worklist_view2.Push(&dummy2));
+  worklist.FlushToGlobal(0);
+  worklist.FlushToGlobal(1);
+  EXPECT_FALSE(worklist.IsGlobalPoolEmpty());
+  SomeObject* retrieved1 = nullptr;
+  SomeObject* retrieved2 = nullptr;
+  EXPECT_TRUE(worklist_view3.Pop(&retrieved1));
+  EXPECT_TRUE(worklist_view3.Pop(&retrieved2));
+  EXPECT_NE(retrieved1, retrieved2);
+  EXPECT_TRUE(retrieved1 == &dummy1 || retrieved1 == &dummy2);
+  EXPECT_TRUE(retrieved2 == &dummy1 || retrieved2 == &dummy2);
+  EXPECT_FALSE(worklist_view3.Pop(&retrieved1));
+  EXPECT_TRUE(worklist.IsGlobalPoolEmpty());
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+}
+
 TEST(WorkListTest, MergeGlobalPool) {
   TestWorklist worklist1;
   TestWorklist::View worklist_view1(&worklist1, 0);
@@ -327,5 +382,193 @@ TEST(WorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsGlobalEmpty());
 }
 
+TEST(WorkListTest, MergeGlobalPoolWithFewerTasks) {
+  TestWorklist worklist1;
+  TestWorklist::View worklist_view1(&worklist1, 3);
+  SomeObject dummy;
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  worklist1.FlushToGlobal(3);
+  TestWorklist worklist2(2);
+  TestWorklist::View worklist_view2(&worklist2, 0);
+  worklist2.MergeGlobalPool(&worklist1);
+  EXPECT_TRUE(worklist1.IsGlobalEmpty());
+  EXPECT_FALSE(worklist2.IsGlobalEmpty());
+  SomeObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_TRUE(worklist2.IsGlobalEmpty());
+}
+
+namespace {
+
+const int kItemsPerTask = 10000;
+
+// Pushes its own items and pops one item after every few pushes, so that
+// segments are published, popped from the own pool and stolen by other tasks
+// concurrently.
+class PushPopThread final : public base::Thread {
+ public:
+  PushPopThread()
+      : base::Thread(Options("PushPopThread")),
+        worklist_(nullptr),
+        objects_(nullptr),
+        popped_(nullptr),
+        task_id_(0) {}
+
+  void Initialize(TestWorklist* worklist, SomeObject* objects,
+                  base::AtomicNumber<int>* popped, int task_id) {
+    worklist_ = worklist;
+    objects_ = objects;
+    popped_ = popped;
+    task_id_ = task_id;
+  }
+
+  void Run() final {
+    TestWorklist::View view(worklist_, task_id_);
+    SomeObject* retrieved = nullptr;
+    for (int i = 0; i < kItemsPerTask; i++) {
+      EXPECT_TRUE(view.Push(&objects_[task_id_ * kItemsPerTask + i]));
+      if (i % 3 == 0 && view.Pop(&retrieved)) Record(retrieved);
+    }
+    worklist_->FlushToGlobal(task_id_);
+    while (view.Pop(&retrieved)) Record(retrieved);
+  }
+
+ private:
+  void Record(SomeObject* object) { popped_[object - objects_].Increment(1); }
+
+  TestWorklist* worklist_;
+  SomeObject* objects_;
+  base::AtomicNumber<int>* popped_;
+  int task_id_;
+};
+
+}  // namespace
+
+TEST(WorkListTest, ConcurrentPushPopAndSteal) {
+  const int kNumTasks = TestWorklist::kMaxNumTasks;
+  const int kNumItems = kNumTasks * kItemsPerTask;
+  TestWorklist worklist;
+  std::vector<SomeObject> objects(kNumItems);
+  std::vector<base::AtomicNumber<int>> popped(kNumItems);
+  PushPopThread threads[kNumTasks];
+  for (int i = 0; i < kNumTasks; i++) {
+    threads[i].Initialize(&worklist, objects.data(), popped.data(), i);
+  }
+  for (int i = 0; i < kNumTasks; i++) {
+    threads[i].Start();
+  }
+  for (int i = 0; i < kNumTasks; i++) {
+    threads[i].Join();
+  }
+  // Tasks that finished early may have stopped before others published their
+  // last segments. Drain whatever is left from the main thread.
+  TestWorklist::View view(&worklist, 0);
+  SomeObject* retrieved = nullptr;
+  while (view.Pop(&retrieved)) popped[retrieved - objects.data()].Increment(1);
+  EXPECT_TRUE(worklist.IsGlobalPoolEmpty());
+  EXPECT_TRUE(worklist.IsGlobalEmpty());
+  for (int i = 0; i < kNumItems; i++) {
+    EXPECT_EQ(1, popped[i].Value());
+  }
+}
+
+namespace {
+
+// Each entry is the depth of a node in a complete binary tree. Processing a
+// node pushes its two children, so all work starts on task 0 and has to be
+// stolen by the other tasks, like marking from a single root would.
+using TreeWorklist = Worklist<int, 64>;
+
+const int kTreeDepth = 17;
+const int kTreeNodes = (1 << (kTreeDepth + 1)) - 1;
+
+class TreeThread final : public base::Thread {
+ public:
+  TreeThread()
+      : base::Thread(Options("TreeThread")),
+        worklist_(nullptr),
+        barrier_(nullptr),
+        task_id_(0),
+        processed_(0) {}
+
+  void Initialize(TreeWorklist* worklist, OneshotBarrier* barrier,
+                  int task_id) {
+    worklist_ = worklist;
+    barrier_ = barrier;
+    task_id_ = task_id;
+    processed_ = 0;
+  }
+
+  void Run() final {
+    TreeWorklist::View view(worklist_, task_id_);
+    do {
+      int depth;
+      while (view.Pop(&depth)) {
+        Visit(depth);
+        if (depth > 0) {
+          view.Push(depth - 1);
+          view.Push(depth - 1);
+        }
+        if (++processed_ % TreeWorklist::kSegmentCapacity == 0 &&
+            !view.IsGlobalPoolEmpty()) {
+          barrier_->NotifyAll();
+        }
+      }
+    } while (!barrier_->Wait());
+  }
+
+  size_t processed() const { return processed_; }
+
+ private:
+  // Stands in for visiting the fields of an object.
+  void Visit(int depth) {
+    volatile int sink = depth;
+    for (int i = 0; i < 100; i++) sink = sink * 31 + i;
+  }
+
+  TreeWorklist* worklist_;
+  OneshotBarrier* barrier_;
+  int task_id_;
+  size_t processed_;
+};
+
+}  // namespace
+
+// Processes the same tree with an increasing number of tasks and records the
+// time taken for each as test properties (see --gtest_output=xml), so that
+// the scaling of stealing can be compared across machines.
+TEST(WorkListTest, StealingScalesWithTasks) {
+  for (int num_tasks = 1; num_tasks <= TreeWorklist::kMaxNumTasks;
+       num_tasks *= 2) {
+    TreeWorklist worklist(num_tasks);
+    OneshotBarrier barrier;
+    TreeThread threads[TreeWorklist::kMaxNumTasks];
+    for (int i = 0; i < num_tasks; i++) {
+      threads[i].Initialize(&worklist, &barrier, i);
+      barrier.Start();
+    }
+    TreeWorklist::View(&worklist, 0).Push(kTreeDepth);
+    base::ElapsedTimer timer;
+    timer.Start();
+    for (int i = 0; i < num_tasks; i++) {
+      threads[i].Start();
+    }
+    for (int i = 0; i < num_tasks; i++) {
+      threads[i].Join();
+    }
+    int64_t microseconds = timer.Elapsed().InMicroseconds();
+    size_t processed = 0;
+    for (int i = 0; i < num_tasks; i++) {
+      processed += threads[i].processed();
+    }
+    EXPECT_EQ(static_cast<size_t>(kTreeNodes), processed);
+    EXPECT_TRUE(worklist.IsGlobalEmpty());
+    std::string key = "microseconds_with_" + std::to_string(num_tasks) +
+                      "_tasks";
+    ::testing::Test::RecordProperty(key, static_cast<int>(microseconds));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -86,6 +86,7 @@
       'compiler/node-unittest.cc',
       'compiler/opcodes-unittest.cc',
       'compiler/persistent-unittest.cc',
+      'compiler/redundancy-elimination-unittest.cc',
       'compiler/regalloc/register-allocator-unittest.cc',
       'compiler/schedule-unittest.cc',
       'compiler/scheduler-unittest.cc',